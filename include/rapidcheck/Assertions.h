@@ -2,6 +2,7 @@
 
 #include "rapidcheck/detail/Results.h"
 #include "rapidcheck/detail/Capture.h"
+#include "rapidcheck/detail/Platform.h"
 
 #define RC_INTERNAL_CONDITIONAL_RESULT(                                        \
     ResultType, expression, invert, name, ...)                                 \
@@ -13,6 +14,20 @@
                          name "(" #expression ")")
 
 
+#define RC_INTERNAL_CONDITIONAL_RETURN(                                        \
+    ResultType, expression, invert, name, ...)                                 \
+  do {                                                                         \
+    if (!::rc::detail::checkAssertion(                                         \
+            RC_INTERNAL_CAPTURE(expression),                                   \
+            (invert),                                                          \
+            ::rc::detail::CaseResult::Type::ResultType,                        \
+            __FILE__,                                                          \
+            __LINE__,                                                          \
+            name "(" #expression ")")) {                                       \
+      return;                                                                  \
+    }                                                                          \
+  } while (false)
+
 #define RC_INTERNAL_STRINGIFY(x) #x
 
 #define RC_INTERNAL_UNCONDITIONAL_RESULT(ResultType, name, expression)         \
@@ -23,6 +38,15 @@
             __FILE__, __LINE__, name "(" #expression ")", {expression}));      \
   } while (false)
 
+#define RC_INTERNAL_UNCONDITIONAL_RETURN(ResultType, name, expression)         \
+  do {                                                                         \
+    ::rc::detail::reportResult(::rc::detail::CaseResult(                       \
+        ::rc::detail::CaseResult::Type::ResultType,                            \
+        ::rc::detail::makeMessage(                                             \
+            __FILE__, __LINE__, name "(" #expression ")", {expression})));     \
+    return;                                                                    \
+  } while (false)
+
 /// Fails the current test case unless the given condition is `true`.
 #define RC_ASSERT(expression)                                                  \
   RC_INTERNAL_CONDITIONAL_RESULT(Failure, expression, true, "RC_ASSERT", )
@@ -94,4 +118,26 @@
 #define RC_DISCARD(...)                                                        \
   RC_INTERNAL_UNCONDITIONAL_RESULT(Discard, "RC_DISCARD", __VA_ARGS__)
 
+/// Like `RC_ASSERT` but reports the failure to the current property and
+/// returns from the enclosing function instead of throwing. Can only be used in
+/// functions returning `void`.
+#define RC_ASSERT_RETURN(expression)                                           \
+  RC_INTERNAL_CONDITIONAL_RETURN(                                              \
+      Failure, expression, true, "RC_ASSERT_RETURN", )
+
+/// Like `RC_FAIL` but reports the failure to the current property and returns
+/// from the enclosing function instead of throwing.
+#define RC_FAIL_RETURN(...)                                                    \
+  RC_INTERNAL_UNCONDITIONAL_RETURN(Failure, "RC_FAIL_RETURN", __VA_ARGS__)
+
+/// Like `RC_PRE` but reports the discard to the current property and returns
+/// from the enclosing function instead of throwing.
+#define RC_PRE_RETURN(expression)                                              \
+  RC_INTERNAL_CONDITIONAL_RETURN(Discard, expression, true, "RC_PRE_RETURN", )
+
+/// Like `RC_DISCARD` but reports the discard to the current property and
+/// returns from the enclosing function instead of throwing.
+#define RC_DISCARD_RETURN(...)                                                 \
+  RC_INTERNAL_UNCONDITIONAL_RETURN(Discard, "RC_DISCARD_RETURN", __VA_ARGS__)
+
 #include "Assertions.hpp"
@@ -22,20 +22,68 @@ std::string makeWrongExceptionMessage(const std::string &file,
                                       const std::string &assertion,
                                       const std::string &expected);
 
+/// Reports the given result to the current property context. If there is no
+/// property context that handles it, it is thrown instead.
+void reportResult(const CaseResult &result);
+
+/// Throws the `CaseResult` for an assertion that did not hold. This is kept
+/// out of `doAssert` so that the passing case stays small enough to inline and
+/// does not touch any strings.
+template <typename Expression>
+[[noreturn]] RC_INTERNAL_NOINLINE void
+failAssertion(const Expression &expression,
+              CaseResult::Type type,
+              const char *file,
+              int line,
+              const char *assertion) {
+  std::ostringstream ss;
+  expression.show(ss);
+  throw CaseResult(type,
+                   makeExpressionMessage(file, line, assertion, ss.str()));
+}
+
 template <typename Expression>
 void doAssert(const Expression &expression,
               bool expectedResult,
               CaseResult::Type type,
-              const std::string &file,
+              const char *file,
               int line,
-              const std::string &assertion) {
+              const char *assertion) {
   if (static_cast<bool>(expression.value()) != expectedResult) {
-    std::ostringstream ss;
-    expression.show(ss);
-    throw CaseResult(type,
-                     makeExpressionMessage(file, line, assertion, ss.str()));
+    failAssertion(expression, type, file, line, assertion);
   }
 }
 
+/// Reports the `CaseResult` for an assertion that did not hold to the current
+/// property context.
+template <typename Expression>
+RC_INTERNAL_NOINLINE void reportAssertion(const Expression &expression,
+                                          CaseResult::Type type,
+                                          const char *file,
+                                          int line,
+                                          const char *assertion) {
+  std::ostringstream ss;
+  expression.show(ss);
+  reportResult(CaseResult(
+      type, makeExpressionMessage(file, line, assertion, ss.str())));
+}
+
+/// Returns `true` if the given expression has the expected result. Otherwise,
+/// reports a result of the given type and returns `false`.
+template <typename Expression>
+bool checkAssertion(const Expression &expression,
+                    bool expectedResult,
+                    CaseResult::Type type,
+                    const char *file,
+                    int line,
+                    const char *assertion) {
+  if (static_cast<bool>(expression.value()) != expectedResult) {
+    reportAssertion(expression, type, file, line, assertion);
+    return false;
+  }
+
+  return true;
+}
+
 } // namespace detail
 } // namespace rc
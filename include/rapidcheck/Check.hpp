@@ -10,6 +10,14 @@
 namespace rc {
 namespace detail {
 
+TestResult
+checkProperty(const Property &property,
+              const TestMetadata &metadata,
+              const TestParams &params,
+              TestListener &listener,
+              const std::unordered_map<std::string, Reproduce> &reproduceMap,
+              const std::string &exampleDatabase);
+
 TestResult
 checkProperty(const Property &property,
               const TestMetadata &metadata,
@@ -3,6 +3,7 @@
 #include <cassert>
 
 #include "rapidcheck/detail/Any.h"
+#include "rapidcheck/detail/ImplPool.h"
 #include "rapidcheck/detail/ImplicitParam.h"
 #include "rapidcheck/gen/detail/GenerationHandler.h"
 #include "rapidcheck/shrinkable/Create.h"
@@ -48,6 +49,14 @@ public:
     }
   }
 
+  static void *operator new(std::size_t size) {
+    return rc::detail::ImplPool::allocate(size);
+  }
+
+  static void operator delete(void *p, std::size_t size) noexcept {
+    rc::detail::ImplPool::deallocate(p, size);
+  }
+
 private:
   const Impl m_impl;
   std::atomic<long> m_count;
@@ -6,8 +6,12 @@ namespace detail {
 /// Returns the current logging stream.
 std::ostream &log();
 
-/// Logs the given message.
+/// Logs the given message. This does not involve any stream formatting so it
+/// is the cheaper choice for properties that log a lot.
 void log(const std::string &msg);
 
+/// Logs the given message.
+void log(const char *msg);
+
 } // namespace detail
 } // namespace rc
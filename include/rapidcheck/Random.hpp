@@ -11,7 +11,10 @@ Iterator serialize(const Random &random, Iterator output) {
   oit = serializeN(begin(random.m_key), random.m_key.size(), oit);
   oit = serializeCompact(random.m_bits, oit);
   oit = serializeCompact(random.m_counter, oit);
-  *oit = random.m_bitsi;
+  // `m_bitsi` is at most 64 so the top bit is free to mark the engine
+  *oit = (random.m_engine == Random::Engine::Fast)
+      ? static_cast<uint8_t>(random.m_bitsi | Random::kFastEngineFlag)
+      : random.m_bitsi;
   return ++oit;
 }
 
@@ -26,9 +29,18 @@ Iterator deserialize(Iterator begin, Iterator end, Random &output) {
 
   Random::Counter counter;
   iit = deserializeCompact(iit, end, counter);
+  if (iit == end) {
+    throw SerializationException("Unexpected end of input");
+  }
+
+  const uint8_t bitsi = *iit;
+  output.m_engine = ((bitsi & Random::kFastEngineFlag) != 0)
+      ? Random::Engine::Fast
+      : Random::Engine::Default;
+  output.m_block = Random::Block();
   // Normally, the block is calculated lazily if counter is divisible by 4 so
   // let's simulate this.
-  if (counter != 0) {
+  if ((output.m_engine == Random::Engine::Default) && (counter != 0)) {
     const auto blki =
         ((counter - 1) % std::tuple_size<Random::Block>::value) + 1;
     if (blki != 0) {
@@ -39,7 +51,7 @@ Iterator deserialize(Iterator begin, Iterator end, Random &output) {
   }
   output.m_counter = counter;
 
-  output.m_bitsi = *iit;
+  output.m_bitsi = bitsi & ~Random::kFastEngineFlag;
   return ++iit;
 }
 
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <type_traits>
+#include <cstddef>
 #include <memory>
 #include <iostream>
+#include <new>
 
 #include "rapidcheck/Nothing.h"
 #include "rapidcheck/Maybe.h"
@@ -59,8 +61,9 @@ public:
 
   Seq(const Seq &other);
   Seq &operator=(const Seq &rhs);
-  Seq(Seq &&other) noexcept = default;
-  Seq &operator=(Seq &&rhs) noexcept = default;
+  Seq(Seq &&other) noexcept;
+  Seq &operator=(Seq &&rhs) noexcept;
+  ~Seq() noexcept;
 
 private:
   class ISeqImpl;
@@ -68,7 +71,30 @@ private:
   template <typename Impl>
   class SeqImpl;
 
-  std::unique_ptr<ISeqImpl> m_impl;
+  template <typename Impl, typename... Args>
+  void emplace(std::true_type, Args &&... args);
+
+  template <typename Impl, typename... Args>
+  void emplace(std::false_type, Args &&... args);
+
+  void reset() noexcept;
+
+  // Most implementation objects, such as the shrinks of an integer, are only a
+  // few words large so they are stored inline instead of on the heap
+  static constexpr std::size_t kInlineSize = 4 * sizeof(void *);
+  using Storage = typename std::aligned_storage<kInlineSize>::type;
+
+  template <typename Impl>
+  using FitsInline =
+      std::integral_constant<bool,
+                             (sizeof(SeqImpl<Impl>) <= sizeof(Storage)) &&
+                                 (alignof(SeqImpl<Impl>) <= alignof(Storage)) &&
+                                 std::is_nothrow_move_constructible<
+                                     Impl>::value>;
+
+  ISeqImpl *m_impl = nullptr;
+  bool m_inline = false;
+  Storage m_storage;
 };
 
 /// Two `Seq`s are considered equal if they return equal values. Note that this
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "rapidcheck/Show.h"
+#include "rapidcheck/detail/ImplPool.h"
 #include "rapidcheck/Compat.h"
 
 namespace rc {
@@ -9,7 +10,8 @@ template <typename T>
 class Seq<T>::ISeqImpl {
 public:
   virtual Maybe<T> next() = 0;
-  virtual std::unique_ptr<ISeqImpl> copy() const = 0;
+  virtual void copyTo(Seq &seq) const = 0;
+  virtual void moveTo(Seq &seq) noexcept = 0;
   virtual ~ISeqImpl() = default;
 };
 
@@ -23,8 +25,20 @@ public:
 
   Maybe<T> next() override { return m_impl(); }
 
-  std::unique_ptr<ISeqImpl> copy() const override {
-    return std::unique_ptr<ISeqImpl>(new SeqImpl(*this));
+  void copyTo(Seq &seq) const override {
+    seq.template emplace<Impl>(FitsInline<Impl>(), m_impl);
+  }
+
+  void moveTo(Seq &seq) noexcept override {
+    seq.template emplace<Impl>(FitsInline<Impl>(), std::move(m_impl));
+  }
+
+  static void *operator new(std::size_t size) {
+    return rc::detail::ImplPool::allocate(size);
+  }
+
+  static void operator delete(void *p, std::size_t size) noexcept {
+    rc::detail::ImplPool::deallocate(p, size);
   }
 
 private:
@@ -36,36 +50,98 @@ Seq<T>::Seq(NothingType) noexcept {}
 
 template <typename T>
 template <typename Impl, typename>
-Seq<T>::Seq(Impl &&impl)
-    : m_impl(new SeqImpl<Decay<Impl>>(std::forward<Impl>(impl))) {}
+Seq<T>::Seq(Impl &&impl) {
+  emplace<Decay<Impl>>(FitsInline<Decay<Impl>>(), std::forward<Impl>(impl));
+}
 
 template <typename T>
 Maybe<T> Seq<T>::next() noexcept {
   try {
     return m_impl ? m_impl->next() : Nothing;
   } catch (...) {
-    m_impl.reset();
+    reset();
     return Nothing;
   }
 }
 
 template <typename T>
-Seq<T>::Seq(const Seq &other)
-    : m_impl(other.m_impl ? other.m_impl->copy() : nullptr) {}
+Seq<T>::Seq(const Seq &other) {
+  if (other.m_impl) {
+    other.m_impl->copyTo(*this);
+  }
+}
 
 template <typename T>
 Seq<T> &Seq<T>::operator=(const Seq &rhs) {
-  m_impl = rhs.m_impl->copy();
+  if (this != &rhs) {
+    *this = Seq(rhs);
+  }
+  return *this;
+}
+
+template <typename T>
+Seq<T>::Seq(Seq &&other) noexcept {
+  if (other.m_inline) {
+    other.m_impl->moveTo(*this);
+    other.reset();
+  } else {
+    m_impl = other.m_impl;
+    other.m_impl = nullptr;
+  }
+}
+
+template <typename T>
+Seq<T> &Seq<T>::operator=(Seq &&rhs) noexcept {
+  if (this != &rhs) {
+    reset();
+    if (rhs.m_inline) {
+      rhs.m_impl->moveTo(*this);
+      rhs.reset();
+    } else {
+      m_impl = rhs.m_impl;
+      rhs.m_impl = nullptr;
+    }
+  }
   return *this;
 }
 
+template <typename T>
+Seq<T>::~Seq() noexcept {
+  reset();
+}
+
+template <typename T>
+template <typename Impl, typename... Args>
+void Seq<T>::emplace(std::true_type, Args &&... args) {
+  m_impl = ::new (static_cast<void *>(&m_storage))
+      SeqImpl<Impl>(std::forward<Args>(args)...);
+  m_inline = true;
+}
+
+template <typename T>
+template <typename Impl, typename... Args>
+void Seq<T>::emplace(std::false_type, Args &&... args) {
+  m_impl = new SeqImpl<Impl>(std::forward<Args>(args)...);
+  m_inline = false;
+}
+
+template <typename T>
+void Seq<T>::reset() noexcept {
+  if (m_inline) {
+    m_impl->~ISeqImpl();
+  } else {
+    delete m_impl;
+  }
+  m_impl = nullptr;
+  m_inline = false;
+}
+
 template <typename Impl, typename... Args>
 Seq<typename rc::compat::return_type<Impl>::type::ValueType> makeSeq(Args &&... args) {
   using SeqT = Seq<typename rc::compat::return_type<Impl>::type::ValueType>;
-  using ImplT = typename SeqT::template SeqImpl<Impl>;
-
   SeqT seq;
-  seq.m_impl.reset(new ImplT(std::forward<Args>(args)...));
+  seq.template emplace<Impl>(typename SeqT::template FitsInline<Impl>(),
+                             std::forward<Args>(args)...);
   return seq;
 }
 
@@ -2,6 +2,8 @@
 
 #include <atomic>
 
+#include "rapidcheck/detail/ImplPool.h"
+
 namespace rc {
 
 template <typename T>
@@ -34,6 +36,14 @@ public:
     }
   }
 
+  static void *operator new(std::size_t size) {
+    return rc::detail::ImplPool::allocate(size);
+  }
+
+  static void operator delete(void *p, std::size_t size) noexcept {
+    rc::detail::ImplPool::deallocate(p, size);
+  }
+
 private:
   const Impl m_impl;
   std::atomic<long> m_count;
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <string>
+#include <type_traits>
 
 namespace rc {
 namespace detail {
@@ -37,11 +40,21 @@ public:
   /// Outputs a string representation of the value to the given output stream.
   void showValue(std::ostream &os) const;
 
+  /// If the type of the contained value supports hashing, sets `hash` to the
+  /// hash of the value and returns `true`. Otherwise, returns `false`.
+  bool hashValue(std::size_t &hash) const;
+
+  /// Returns `true` if both `Any`s contain values of the same type that are
+  /// equal. Values of types for which `hashValue` returns `false` are never
+  /// equal.
+  bool equalValue(const Any &other) const;
+
   /// Returns `true` if this `Any` is non-null.
   explicit operator bool() const;
 
-  Any(Any &&other) noexcept = default;
-  Any &operator=(Any &&rhs) noexcept = default;
+  Any(Any &&other) noexcept;
+  Any &operator=(Any &&rhs) noexcept;
+  ~Any() noexcept;
 
 private:
   class IAnyImpl;
@@ -49,7 +62,29 @@ private:
   template <typename T>
   class AnyImpl;
 
-  std::unique_ptr<IAnyImpl> m_impl;
+  template <typename T, typename Arg>
+  void emplace(std::true_type, Arg &&arg);
+
+  template <typename T, typename Arg>
+  void emplace(std::false_type, Arg &&arg);
+
+  void moveFrom(Any &other) noexcept;
+
+  // Small values, such as integers or strings, are stored inline instead of on
+  // the heap
+  static constexpr std::size_t kInlineSize = 5 * sizeof(void *);
+  using Storage = std::aligned_storage<kInlineSize>::type;
+
+  template <typename T>
+  using FitsInline =
+      std::integral_constant<bool,
+                             (sizeof(AnyImpl<T>) <= sizeof(Storage)) &&
+                                 (alignof(AnyImpl<T>) <= alignof(Storage)) &&
+                                 std::is_nothrow_move_constructible<T>::value>;
+
+  IAnyImpl *m_impl;
+  bool m_inline;
+  Storage m_storage;
 };
 
 std::ostream &operator<<(std::ostream &os, const Any &value);
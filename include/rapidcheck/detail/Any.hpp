@@ -6,6 +6,7 @@
 #include "rapidcheck/Show.h"
 #include "Utility.h"
 #include "ShowType.h"
+#include "ValueHash.h"
 
 namespace rc {
 namespace detail {
@@ -13,8 +14,12 @@ namespace detail {
 class Any::IAnyImpl {
 public:
   virtual void *get() = 0;
+  virtual void moveTo(Any &any) noexcept = 0;
   virtual void showType(std::ostream &os) const = 0;
   virtual void showValue(std::ostream &os) const = 0;
+  virtual const void *typeKey() const = 0;
+  virtual bool hashValue(std::size_t &hash) const = 0;
+  virtual bool equalValue(const IAnyImpl &other) const = 0;
 #ifndef RC_DONT_USE_RTTI
   virtual const std::type_info &typeInfo() const = 0;
 #endif // RC_DONT_USE_RTTI
@@ -30,10 +35,33 @@ public:
 
   void *get() override { return &m_value; }
 
+  void moveTo(Any &any) noexcept override {
+    any.emplace<T>(FitsInline<T>(), std::move(m_value));
+  }
+
   void showType(std::ostream &os) const override { rc::detail::showType<T>(os); }
 
   void showValue(std::ostream &os) const override { show(m_value, os); }
 
+  const void *typeKey() const override {
+    static const char key = 0;
+    return &key;
+  }
+
+  bool hashValue(std::size_t &hash) const override {
+    if (!ValueHash<T>::kEnabled) {
+      return false;
+    }
+    hash = ValueHash<T>::hash(m_value);
+    return true;
+  }
+
+  // Only called when both have the same `typeKey()`
+  bool equalValue(const IAnyImpl &other) const override {
+    return ValueHash<T>::equal(m_value,
+                               static_cast<const AnyImpl &>(other).m_value);
+  }
+
 #ifndef RC_DONT_USE_RTTI
   const std::type_info &typeInfo() const override { return typeid(T); }
 #endif // RC_DONT_USE_RTTI
@@ -46,10 +74,23 @@ private:
 template <typename T>
 Any Any::of(T &&value) {
   Any any;
-  any.m_impl.reset(new AnyImpl<Decay<T>>(std::forward<T>(value)));
+  any.emplace<Decay<T>>(FitsInline<Decay<T>>(), std::forward<T>(value));
   return any;
 }
 
+template <typename T, typename Arg>
+void Any::emplace(std::true_type, Arg &&arg) {
+  m_impl =
+      ::new (static_cast<void *>(&m_storage)) AnyImpl<T>(std::forward<Arg>(arg));
+  m_inline = true;
+}
+
+template <typename T, typename Arg>
+void Any::emplace(std::false_type, Arg &&arg) {
+  m_impl = new AnyImpl<T>(std::forward<Arg>(arg));
+  m_inline = false;
+}
+
 template <typename T>
 const T &Any::get() const {
   assert(m_impl);
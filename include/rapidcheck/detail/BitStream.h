@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace rc {
@@ -27,6 +28,11 @@ public:
   template <typename T>
   T nextWithSize(int size);
 
+  /// Fills `output` with `n` random bytes. This consumes the same bits as
+  /// calling `next<uint8_t>()` `n` times and yields the same bytes, but takes
+  /// whole words from the source at a time.
+  void fillBytes(uint8_t *output, std::size_t n);
+
 private:
   template <typename T>
   T next(int nbits, std::true_type);
@@ -34,6 +40,9 @@ private:
   template <typename T>
   T next(int nbits, std::false_type);
 
+  void nextWords(uint64_t *output, std::size_t n, std::true_type);
+  void nextWords(uint64_t *output, std::size_t n, std::false_type);
+
   Source m_source;
   uint64_t m_bits;
   int m_numBits;
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <limits>
 
+#include "rapidcheck/Traits.h"
+#include "rapidcheck/detail/Traits.h"
 #include "rapidcheck/detail/Utility.h"
 
 namespace rc {
@@ -12,6 +15,10 @@ constexpr int numBits() {
   return std::numeric_limits<T>::digits + (std::is_signed<T>::value ? 1 : 0);
 }
 
+RC_SFINAE_TRAIT(HasFill,
+                decltype(std::declval<T &>().fill(
+                    static_cast<uint64_t *>(nullptr), std::size_t(0))))
+
 template <typename Source>
 BitStream<Source>::BitStream(Source source)
     : m_source(source)
@@ -88,6 +95,53 @@ T BitStream<Source>::nextWithSize(int size) {
   return next<T>((size * numBits<T>() + (kNominalSize / 2)) / kNominalSize);
 }
 
+template <typename Source>
+void BitStream<Source>::fillBytes(uint8_t *output, std::size_t n) {
+  constexpr auto kWordBytes = sizeof(uint64_t);
+  constexpr std::size_t kMaxWords = 32;
+  uint64_t words[kMaxWords];
+  while (n >= kWordBytes) {
+    const auto numWords = std::min(n / kWordBytes, kMaxWords);
+    nextWords(words, numWords, HasFill<Decay<Source>>());
+    // Bits are consumed from the least significant end so this is the same as
+    // taking a byte at a time
+    for (std::size_t i = 0; i < numWords; i++) {
+      auto word = words[i];
+      for (std::size_t j = 0; j < kWordBytes; j++) {
+        *output++ = static_cast<uint8_t>(word);
+        word >>= 8;
+      }
+    }
+    n -= numWords * kWordBytes;
+  }
+
+  while (n > 0) {
+    *output++ = next<uint8_t>();
+    n--;
+  }
+}
+
+template <typename Source>
+void BitStream<Source>::nextWords(uint64_t *output,
+                                  std::size_t n,
+                                  std::true_type) {
+  // Without buffered bits, the words can be taken straight from the source
+  if (m_numBits == 0) {
+    m_source.fill(output, n);
+  } else {
+    nextWords(output, n, std::false_type());
+  }
+}
+
+template <typename Source>
+void BitStream<Source>::nextWords(uint64_t *output,
+                                  std::size_t n,
+                                  std::false_type) {
+  for (std::size_t i = 0; i < n; i++) {
+    output[i] = next<uint64_t>();
+  }
+}
+
 template <typename Source>
 BitStream<Source &> bitStreamOf(Source &source) {
   return BitStream<Source &>(source);
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rapidcheck/detail/LatencyHistogram.h"
+
+#ifndef RC_DONT_USE_RTTI
+#include <typeindex>
+#include <unordered_map>
+#endif // RC_DONT_USE_RTTI
+
+namespace rc {
+namespace detail {
+
+/// The number of times that a type of command was run and how long it took.
+struct CommandStats {
+  /// The name of the command type.
+  std::string name;
+
+  /// The durations of the runs in nanoseconds.
+  LatencyHistogram latencies;
+};
+
+/// Collects `CommandStats` for every type of command that is run while it is
+/// the current recorder. Safe to use from several threads.
+class CommandStatsRecorder {
+public:
+  /// Returns the current recorder or `nullptr` if commands should not be
+  /// measured.
+  static CommandStatsRecorder *current() noexcept;
+
+#ifndef RC_DONT_USE_RTTI
+  /// Records a run of a command of the given type.
+  void record(const std::type_info &type, std::uint64_t nanos);
+#endif // RC_DONT_USE_RTTI
+
+  /// Records a run of a command with the given name.
+  void record(const std::string &name, std::uint64_t nanos);
+
+  /// Returns the collected stats sorted by name.
+  std::vector<CommandStats> stats() const;
+
+private:
+  mutable std::mutex m_mutex;
+  std::map<std::string, LatencyHistogram> m_byName;
+#ifndef RC_DONT_USE_RTTI
+  std::unordered_map<std::type_index, LatencyHistogram> m_byType;
+#endif // RC_DONT_USE_RTTI
+};
+
+/// Makes the given recorder the current one for as long as the scope is alive.
+/// The recorder is shared by all threads. `nullptr` disables recording.
+class CommandStatsScope {
+public:
+  explicit CommandStatsScope(CommandStatsRecorder *recorder);
+  CommandStatsScope(const CommandStatsScope &) = delete;
+  CommandStatsScope &operator=(const CommandStatsScope &) = delete;
+  ~CommandStatsScope();
+
+private:
+  CommandStatsRecorder *m_previous;
+};
+
+/// Prints a table of the given stats to the given output stream.
+void printCommandStats(const std::vector<CommandStats> &stats,
+                       std::ostream &os);
+
+} // namespace detail
+} // namespace rc
@@ -24,6 +24,10 @@ struct Configuration {
   /// Any test failures to reproduce. Mapping from test ID to `Reproduce`
   /// structre.
   std::unordered_map<std::string, Reproduce> reproduce;
+
+  /// Path to a directory in which failures are stored so that they can be
+  /// replayed in later runs. Empty if no such directory should be used.
+  std::string exampleDatabase;
 };
 
 std::ostream &operator<<(std::ostream &os, const Configuration &config);
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "rapidcheck/Maybe.h"
+#include "rapidcheck/detail/Any.h"
+#include "rapidcheck/detail/Results.h"
+#include "rapidcheck/gen/detail/Recipe.h"
+
+namespace rc {
+namespace detail {
+
+struct TaggedResult {
+  CaseResult result;
+  Tags tags;
+};
+
+/// Remembers the results of property evaluations so that a shrink that has
+/// already been tried does not have to be evaluated again. Results are keyed by
+/// the random generator, the size and the values of the ingredients that were
+/// given to the evaluation, since those determine the rest of the evaluation.
+/// Values are compared for equality, so a recipe can only be cached if the
+/// values of all of its ingredients support `Any::hashValue`. Failures are
+/// never remembered since a failing shrink is accepted right away.
+///
+/// This class is safe to use from several threads at once.
+class EvaluationCache {
+public:
+  /// The key of a result.
+  struct Key {
+    Random random;
+    int size = 0;
+    std::vector<Any> values;
+    std::size_t hash = 0;
+    /// `false` if the result cannot be cached.
+    bool cacheable = false;
+  };
+
+  EvaluationCache();
+
+  /// Looks up the result for the given recipe. If there is no result, `key`
+  /// is set to the key under which the result should be inserted.
+  Maybe<TaggedResult> lookup(const gen::detail::Recipe &recipe, Key &key);
+
+  /// Inserts the given result unless it is a failure or the key is not
+  /// cacheable.
+  void insert(Key key, const TaggedResult &result);
+
+  /// Returns the number of lookups that found a result.
+  int numHits() const;
+
+  /// Returns the number of lookups that did not find a result.
+  int numMisses() const;
+
+private:
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const { return key.hash; }
+  };
+
+  struct KeyEqual {
+    bool operator()(const Key &lhs, const Key &rhs) const;
+  };
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<Key, TaggedResult, KeyHash, KeyEqual> m_results;
+  int m_numHits;
+  int m_numMisses;
+};
+
+namespace param {
+
+/// The `EvaluationCache` to use for property evaluations, if any.
+struct CurrentEvaluationCache {
+  using ValueType = EvaluationCache *;
+  static EvaluationCache *defaultValue();
+};
+
+} // namespace param
+} // namespace detail
+} // namespace rc
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace rc {
+namespace detail {
+
+/// Memory for the type erased implementation objects of `Shrinkable`, `Seq`
+/// and `Gen`. Every test case creates and destroys a large number of these so
+/// when pooling is enabled on the current thread, released memory is kept in
+/// thread local free lists, one per object size, and handed out again instead
+/// of going back to the global allocator.
+///
+/// Memory from the pool is ordinary heap memory of exactly the requested size
+/// so it is fine to release it on another thread than it was allocated on or
+/// while pooling is disabled. As long as pooling is not enabled anywhere,
+/// `allocate` and `deallocate` go straight to the global allocator.
+class ImplPool {
+public:
+  /// Allocates memory for an object of the given size.
+  static void *allocate(std::size_t size) {
+    if (m_numEnabledScopes.load(std::memory_order_relaxed) == 0) {
+      return ::operator new(size);
+    }
+    return allocatePooled(size);
+  }
+
+  /// Releases memory returned by `allocate` for an object of the given size.
+  static void deallocate(void *p, std::size_t size) noexcept {
+    if (m_numEnabledScopes.load(std::memory_order_relaxed) == 0) {
+      ::operator delete(p);
+      return;
+    }
+    deallocatePooled(p, size);
+  }
+
+  /// Returns whether pooling is enabled on the current thread.
+  static bool isEnabled() noexcept;
+
+  /// Returns the number of allocations that had to be made from the global
+  /// allocator on the current thread while pooling was enabled somewhere.
+  static std::size_t numAllocations() noexcept;
+
+private:
+  friend class ImplPoolScope;
+
+  static void *allocatePooled(std::size_t size);
+  static void deallocatePooled(void *p, std::size_t size) noexcept;
+
+  // The number of live scopes, on any thread, that enable pooling
+  static std::atomic<int> m_numEnabledScopes;
+};
+
+/// Enables or disables pooling on the current thread for as long as the scope
+/// is alive.
+class ImplPoolScope {
+public:
+  explicit ImplPoolScope(bool enabled);
+  ImplPoolScope(const ImplPoolScope &) = delete;
+  ImplPoolScope &operator=(const ImplPoolScope &) = delete;
+  ~ImplPoolScope();
+
+private:
+  bool m_enabled;
+  bool m_wasEnabled;
+};
+
+} // namespace detail
+} // namespace rc
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <stack>
 #include <vector>
 
@@ -24,6 +25,9 @@
 ///     }
 ///     // Here, since foo and bar went out of scope, the previous bindings were
 ///     // restored.
+///
+/// Bindings and scopes are per thread, a binding established on one thread is
+/// never visible on another.
 
 namespace rc {
 namespace detail {
@@ -52,8 +56,15 @@ private:
 
   using Destructor = void (*)();
   using Destructors = std::vector<Destructor>;
-  using ScopeStack = std::stack<Destructors, std::vector<Destructors>>;
-  static ScopeStack m_scopes;
+
+  // Scopes are entered for every generated value so scopes that have been
+  // exited keep their storage around for the next one
+  struct ScopeStack {
+    std::vector<Destructors> scopes;
+    std::size_t depth = 0;
+  };
+
+  static thread_local ScopeStack m_scopes;
 };
 
 /// Constructing an instance of `ImplicitParam<Param>` establishes a binding for
@@ -91,11 +102,11 @@ public:
 private:
   RC_DISABLE_COPY(ImplicitParam)
 
-  void init();
+  static void popBinding();
 
-  using Binding = std::pair<ValueType, ImplicitScope::ScopeStack::size_type>;
+  using Binding = std::pair<ValueType, std::size_t>;
   using StackT = std::stack<Binding, std::vector<Binding>>;
-  static StackT m_stack;
+  static StackT &stack();
 };
 
 } // namespace detail
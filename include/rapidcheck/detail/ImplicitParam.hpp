@@ -8,37 +8,44 @@ namespace detail {
 
 template <typename Param>
 ImplicitParam<Param>::ImplicitParam(ValueType value) {
-  m_stack.push(
-      std::make_pair(std::move(value), ImplicitScope::m_scopes.size()));
-}
-
-template <typename StackT, StackT *stack>
-void popStackBinding() {
-  stack->pop();
+  stack().push(
+      std::make_pair(std::move(value), ImplicitScope::m_scopes.depth));
 }
 
 template <typename Param>
 typename ImplicitParam<Param>::ValueType &ImplicitParam<Param>::value() {
-  const auto scopeLevel = ImplicitScope::m_scopes.size();
-  if (m_stack.empty() || (m_stack.top().second < scopeLevel)) {
-    m_stack.push(
-        std::make_pair(Param::defaultValue(), ImplicitScope::m_scopes.size()));
-    if (!ImplicitScope::m_scopes.empty()) {
-      ImplicitScope::m_scopes.top().push_back(
-          popStackBinding<StackT, &m_stack>);
+  // Every access to a thread local goes through a wrapper that checks whether
+  // it has been initialized so only do that once per call
+  auto &stack = ImplicitParam::stack();
+  auto &scopes = ImplicitScope::m_scopes;
+  const auto scopeLevel = scopes.depth;
+  if (stack.empty() || (stack.top().second < scopeLevel)) {
+    stack.push(std::make_pair(Param::defaultValue(), scopeLevel));
+    if (scopeLevel > 0) {
+      scopes.scopes[scopeLevel - 1].push_back(&ImplicitParam::popBinding);
     }
   }
 
-  return m_stack.top().first;
+  return stack.top().first;
 }
 
 template <typename Param>
 ImplicitParam<Param>::~ImplicitParam() {
-  m_stack.pop();
+  stack().pop();
+}
+
+template <typename Param>
+void ImplicitParam<Param>::popBinding() {
+  stack().pop();
 }
 
 template <typename Param>
-typename ImplicitParam<Param>::StackT ImplicitParam<Param>::m_stack;
+typename ImplicitParam<Param>::StackT &ImplicitParam<Param>::stack() {
+  // A function local instead of a static member since some versions of GCC
+  // emit duplicate TLS guards for thread_local static members of templates
+  thread_local StackT bindings;
+  return bindings;
+}
 
 } // namespace detail
 } // namespace rc
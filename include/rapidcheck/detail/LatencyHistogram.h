@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace rc {
+namespace detail {
+
+/// A histogram of durations in nanoseconds with buckets in the style of HDR
+/// histograms. Values below 32 have a bucket each while every larger power of
+/// two is split into 32 buckets of equal width. This keeps the relative error
+/// of percentiles below about 3% over the entire range while needing at most
+/// a couple of thousand counters.
+class LatencyHistogram {
+public:
+  /// Records the given value.
+  void record(std::uint64_t value);
+
+  /// Adds all values recorded in the given histogram to this one.
+  void merge(const LatencyHistogram &other);
+
+  /// Returns the number of recorded values.
+  std::uint64_t count() const { return m_count; }
+
+  /// Returns the smallest recorded value or `0` if there are none.
+  std::uint64_t min() const { return (m_count == 0) ? 0 : m_min; }
+
+  /// Returns the largest recorded value or `0` if there are none.
+  std::uint64_t max() const { return m_max; }
+
+  /// Returns the mean of the recorded values or `0` if there are none.
+  double mean() const;
+
+  /// Returns an upper bound for the given percentile (`0` to `100`) of the
+  /// recorded values which is never larger than `max()`.
+  std::uint64_t percentile(double percent) const;
+
+private:
+  std::vector<std::uint64_t> m_counts;
+  std::uint64_t m_count = 0;
+  std::uint64_t m_min = 0;
+  std::uint64_t m_max = 0;
+  double m_sum = 0.0;
+};
+
+} // namespace detail
+} // namespace rc
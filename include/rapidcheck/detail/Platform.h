@@ -4,11 +4,14 @@
 
 #if defined(__GNUC__)
 #define RC_INTERNAL_DEPRECATED(msg) __attribute__((deprecated(msg)))
+#define RC_INTERNAL_NOINLINE __attribute__((noinline))
 #elif defined(_MSC_VER)
 #define RC_INTERNAL_DEPRECATED(msg) __declspec(deprecated(msg))
+#define RC_INTERNAL_NOINLINE __declspec(noinline)
 #else
 #pragma message(                                                        \
     "You need to implement RC_INTERNAL_DEPRECATED for this compiler")
+#define RC_INTERNAL_NOINLINE
 #endif
 
 namespace rc {
@@ -21,5 +24,9 @@ std::string demangle(const char *name);
 /// `Nothing` if it is not set.
 Maybe<std::string> getEnvValue(const std::string &name);
 
+/// Creates a directory with the given path unless it already exists. Returns
+/// `true` if the directory exists on return.
+bool makeDirectory(const std::string &path);
+
 } // namespace detail
 } // namespace rc
@@ -1,30 +1,35 @@
 #pragma once
 
+#include <memory>
+
 #include "rapidcheck/detail/FunctionTraits.h"
 #include "rapidcheck/gen/detail/ExecRaw.h"
+#include "rapidcheck/detail/EvaluationCache.h"
 #include "rapidcheck/detail/PropertyContext.h"
 
 namespace rc {
 namespace detail {
 
-struct TaggedResult {
-  CaseResult result;
-  Tags tags;
-};
-
 class AdapterContext : public PropertyContext {
 public:
   AdapterContext();
+  ~AdapterContext();
 
   bool reportResult(const CaseResult &result) override;
   std::ostream &logStream() override;
+  void appendLog(const char *data, std::size_t size) override;
   void addTag(std::string str) override;
   TaggedResult result() const;
 
 private:
+  class LogStream;
+
   CaseResult::Type m_resultType;
   std::vector<std::string> m_messages;
-  std::ostringstream m_logStream;
+  std::string m_log;
+  // Most test cases never log anything so the stream is only created when it
+  // is first asked for. It writes straight to `m_log`.
+  std::unique_ptr<LogStream> m_logStream;
   Tags m_tags;
 };
 
@@ -63,6 +68,21 @@ public:
       : m_callable(std::forward<Arg>(callable)) {}
 
   TaggedResult operator()(Args &&... args) const {
+    const auto cache = ImplicitParam<param::CurrentEvaluationCache>::value();
+    EvaluationCache::Key cacheKey;
+    if (cache) {
+      const auto recipe =
+          ImplicitParam<gen::detail::param::CurrentRecipe>::value();
+      if (recipe) {
+        auto cached = cache->lookup(*recipe, cacheKey);
+        if (cached) {
+          return std::move(*cached);
+        }
+      }
+    }
+
+    // Properties tested from within this one must not share the cache
+    ImplicitParam<param::CurrentEvaluationCache> letCache(nullptr);
     AdapterContext context;
     ImplicitParam<param::CurrentPropertyContext> letContext(&context);
 
@@ -86,7 +106,11 @@ public:
           CaseResult(CaseResult::Type::Failure, "Unknown object thrown"));
     }
 
-    return context.result();
+    auto result = context.result();
+    if (cacheKey.cacheable) {
+      cache->insert(std::move(cacheKey), result);
+    }
+    return result;
   }
 
 private:
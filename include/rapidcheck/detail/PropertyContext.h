@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <iostream>
 
@@ -23,6 +24,10 @@ public:
   /// Returns a stream to which additional information can be logged.
   virtual std::ostream &logStream() = 0;
 
+  /// Appends the given text to the log without going through a stream. The
+  /// default implementation writes it to `logStream()`.
+  virtual void appendLog(const char *data, std::size_t size);
+
   /// Adds a tag to the current scope.
   virtual void addTag(std::string str) = 0;
 
@@ -46,6 +46,8 @@ struct Reproduce {
   Random random;
   /// The size to generate the shrinkable with.
   int size;
+  /// The `TestParams::ddminThreshold` that the shrinks were produced with.
+  int ddminThreshold = 0;
   /// The shrink path to follow.
   std::vector<std::size_t> shrinkPath;
 };
@@ -81,6 +83,12 @@ struct FailureResult {
   Reproduce reproduce;
   /// The counterexample.
   Example counterExample;
+  /// The number of shrinks that were evaluated speculatively while shrinking
+  /// but turned out to be unnecessary.
+  int numWastedShrinks = 0;
+  /// Whether shrinking was stopped early because of a time or step limit in
+  /// which case the counterexample may not be minimal.
+  bool partiallyShrunk = false;
 };
 
 std::ostream &operator<<(std::ostream &os, const detail::FailureResult &result);
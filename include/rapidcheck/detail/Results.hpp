@@ -3,11 +3,21 @@
 namespace rc {
 namespace detail {
 
+constexpr std::uint32_t kReproduceDdminFlag = 0x80000000;
+
 template <typename Iterator>
 Iterator serialize(const Reproduce &value, Iterator output) {
   auto oit = output;
   oit = serialize(value.random, oit);
-  oit = serialize(static_cast<std::uint32_t>(value.size), oit);
+  // The size is never negative so the top bit is free to mark that a ddmin
+  // threshold follows. Without it, older data stays readable.
+  if (value.ddminThreshold == 0) {
+    oit = serialize(static_cast<std::uint32_t>(value.size), oit);
+  } else {
+    oit = serialize(static_cast<std::uint32_t>(value.size) | kReproduceDdminFlag, oit);
+    oit = serializeCompact(static_cast<std::uint32_t>(value.ddminThreshold),
+                           oit);
+  }
   oit = serializeCompact(begin(value.shrinkPath), end(value.shrinkPath), oit);
   return oit;
 }
@@ -19,7 +29,13 @@ Iterator deserialize(Iterator begin, Iterator end, Reproduce &out) {
 
   std::uint32_t size;
   iit = deserialize(iit, end, size);
-  out.size = static_cast<int>(size);
+  out.size = static_cast<int>(size & ~kReproduceDdminFlag);
+  out.ddminThreshold = 0;
+  if ((size & kReproduceDdminFlag) != 0) {
+    std::uint32_t threshold;
+    iit = deserializeCompact(iit, end, threshold);
+    out.ddminThreshold = static_cast<int>(threshold);
+  }
 
   out.shrinkPath.clear();
   const auto p = deserializeCompact<std::size_t>(
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+
+#include "rapidcheck/detail/CommandStats.h"
 #include "rapidcheck/detail/TestMetadata.h"
 #include "rapidcheck/detail/Results.h"
 #include "rapidcheck/detail/Property.h"
@@ -21,6 +24,18 @@ public:
   /// @param accepted  Whether the shrink was accepted or discarded.
   virtual void onShrinkTried(const CaseDescription &shrink, bool accepted) = 0;
 
+  /// Called when shrinking has finished if shrinks were cached.
+  ///
+  /// @param numHits    The number of shrinks whose result was already known.
+  /// @param numMisses  The number of shrinks that had to be evaluated.
+  virtual void onShrinkCacheStats(int numHits, int numMisses) = 0;
+
+  /// Called before the test finishes if command stats are enabled.
+  ///
+  /// @param stats  The stats for every type of command that was run, sorted
+  ///               by name.
+  virtual void onCommandStats(const std::vector<CommandStats> &stats) = 0;
+
   /// Called when the entire test has finished.
   ///
   /// @param metadata  Metadata for the test that was run.
@@ -3,6 +3,8 @@
 #include <iosfwd>
 #include <cstdint>
 
+#include "rapidcheck/Random.h"
+
 namespace rc {
 namespace detail {
 
@@ -10,6 +12,8 @@ namespace detail {
 struct TestParams {
   /// The seed to use.
   uint64_t seed = 0;
+  /// The random engine to use.
+  Random::Engine engine = Random::Engine::Default;
   /// The maximum number of successes before deciding a property passes.
   int maxSuccess = 100;
   /// The maximum size to generate.
@@ -18,6 +22,33 @@ struct TestParams {
   int maxDiscardRatio = 10;
   /// Whether shrinking should be disabled or not.
   bool disableShrinking = false;
+  /// The number of threads to run test cases on while searching for a failure.
+  /// A value of `1` runs every test case on the calling thread.
+  int numThreads = 1;
+  /// The number of shrinks to evaluate concurrently while shrinking. A value of
+  /// `1` evaluates one shrink at a time on the calling thread.
+  int numShrinkThreads = 1;
+  /// The maximum time in milliseconds to spend searching for a failure. `0`
+  /// means no limit.
+  int maxTime = 0;
+  /// The maximum time in milliseconds to spend shrinking a failure. `0` means
+  /// no limit.
+  int maxShrinkTime = 0;
+  /// The maximum number of shrinks to try when shrinking a failure. `0` means
+  /// no limit.
+  int maxShrinkSteps = 0;
+  /// Whether to remember the results of shrinks that did not fail so that
+  /// identical shrinks are not evaluated again.
+  bool cacheShrinks = false;
+  /// Whether to reuse the memory of released `Shrinkable`, `Seq` and `Gen`
+  /// implementation objects, see `ImplPool`.
+  bool poolAllocation = false;
+  /// Whether to count and time the runs of every type of command in state
+  /// tests and report them to the `TestListener`.
+  bool commandStats = false;
+  /// Containers and strings with at least this many elements are shrunk using
+  /// `shrink::ddmin` instead of `shrink::removeChunks`. `0` means never.
+  int ddminThreshold = 0;
 };
 
 bool operator==(const TestParams &p1, const TestParams &p2);
@@ -17,6 +17,8 @@ namespace detail {
   using Name = decltype(Name##Impl::test(std::declval<T>()));
 
 RC_SFINAE_TRAIT(IsStreamInsertible, decltype(std::cout << std::declval<T>()))
+RC_SFINAE_TRAIT(IsEqualityComparable,
+                decltype(std::declval<T>() == std::declval<T>()))
 
 } // namespace detail
 } // namespace rc
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "rapidcheck/detail/Traits.h"
+
+namespace rc {
+namespace detail {
+
+RC_SFINAE_TRAIT(HasStdHash, decltype(std::hash<T>()(std::declval<T>())))
+RC_SFINAE_TRAIT(IsIterable,
+                decltype(std::declval<T>().begin() != std::declval<T>().end()))
+
+enum class ValueHashKind { None, Bitwise, StdHash, Pair, Range };
+
+template <typename T>
+struct IsStdPair : std::false_type {};
+
+template <typename T1, typename T2>
+struct IsStdPair<std::pair<T1, T2>> : std::true_type {};
+
+/// Floating point values are compared bitwise so that `0.0` and `-0.0` are
+/// told apart and `NaN` is equal to itself.
+template <typename T>
+constexpr ValueHashKind valueHashKind() {
+  return std::is_floating_point<T>::value
+      ? ValueHashKind::Bitwise
+      : (HasStdHash<T>::value && IsEqualityComparable<T>::value)
+          ? ValueHashKind::StdHash
+          : IsStdPair<T>::value
+              ? ValueHashKind::Pair
+              : IsIterable<T>::value ? ValueHashKind::Range
+                                     : ValueHashKind::None;
+}
+
+inline std::size_t combineHash(std::size_t seed, std::size_t hash) {
+  return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+/// Hashes values and tells whether two values are the same. Unlike printing a
+/// value, two values are only ever considered the same if they are equal.
+/// `kEnabled` is `false` for types that are not supported.
+template <typename T, ValueHashKind Kind = valueHashKind<T>()>
+struct ValueHash {
+  static constexpr bool kEnabled = false;
+
+  static std::size_t hash(const T &) { return 0; }
+  static bool equal(const T &, const T &) { return false; }
+};
+
+template <typename T>
+struct ValueHash<T, ValueHashKind::Bitwise> {
+  static constexpr bool kEnabled = true;
+
+  static std::size_t hash(const T &value) {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    std::size_t seed = 0;
+    for (const auto byte : bytes) {
+      seed = combineHash(seed, byte);
+    }
+    return seed;
+  }
+
+  static bool equal(const T &lhs, const T &rhs) {
+    return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+  }
+};
+
+template <typename T>
+struct ValueHash<T, ValueHashKind::StdHash> {
+  static constexpr bool kEnabled = true;
+
+  static std::size_t hash(const T &value) { return std::hash<T>()(value); }
+
+  static bool equal(const T &lhs, const T &rhs) {
+    return static_cast<bool>(lhs == rhs);
+  }
+};
+
+template <typename T>
+struct ValueHash<T, ValueHashKind::Pair> {
+  using FirstHash = ValueHash<typename std::decay<typename T::first_type>::type>;
+  using SecondHash =
+      ValueHash<typename std::decay<typename T::second_type>::type>;
+
+  static constexpr bool kEnabled = FirstHash::kEnabled && SecondHash::kEnabled;
+
+  static std::size_t hash(const T &value) {
+    return combineHash(FirstHash::hash(value.first),
+                       SecondHash::hash(value.second));
+  }
+
+  static bool equal(const T &lhs, const T &rhs) {
+    return FirstHash::equal(lhs.first, rhs.first) &&
+        SecondHash::equal(lhs.second, rhs.second);
+  }
+};
+
+template <typename T>
+struct ValueHash<T, ValueHashKind::Range> {
+  using ElementHash = ValueHash<
+      typename std::decay<decltype(*std::declval<const T &>().begin())>::type>;
+
+  static constexpr bool kEnabled = ElementHash::kEnabled;
+
+  static std::size_t hash(const T &value) {
+    std::size_t seed = 0;
+    for (const auto &element : value) {
+      seed = combineHash(seed, ElementHash::hash(element));
+    }
+    return seed;
+  }
+
+  static bool equal(const T &lhs, const T &rhs) {
+    auto lit = lhs.begin();
+    auto rit = rhs.begin();
+    for (; (lit != lhs.end()) && (rit != rhs.end()); ++lit, ++rit) {
+      if (!ElementHash::equal(*lit, *rit)) {
+        return false;
+      }
+    }
+    return (lit == lhs.end()) && (rit == rhs.end());
+  }
+};
+
+} // namespace detail
+} // namespace rc
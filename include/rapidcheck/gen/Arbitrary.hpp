@@ -19,6 +19,9 @@ decltype(Arbitrary<T>::arbitrary()) arbitrary() {
 
 template <typename T, typename>
 struct Arbitrary {
+  // Lets RapidCheck tell whether `Arbitrary` has been specialized for `T`
+  using IsDefaultArbitrary = void;
+
   static decltype(gen::detail::DefaultArbitrary<T>::arbitrary()) arbitrary() {
     return gen::detail::DefaultArbitrary<T>::arbitrary();
   }
@@ -1,7 +1,10 @@
 #pragma once
 
+#include "rapidcheck/detail/ImplicitParam.h"
 #include "rapidcheck/gen/Arbitrary.h"
+#include "rapidcheck/gen/Numeric.h"
 #include "rapidcheck/gen/Tuple.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
 #include "rapidcheck/gen/detail/ShrinkValueIterator.h"
 #include "rapidcheck/shrink/Shrink.h"
 #include "rapidcheck/shrinkable/Create.h"
@@ -13,6 +16,20 @@ namespace detail {
 
 RC_SFINAE_TRAIT(IsAssociativeContainer, typename T::key_type)
 RC_SFINAE_TRAIT(IsMapContainer, typename T::mapped_type)
+RC_SFINAE_TRAIT(IsDefaultArbitrary,
+                typename Arbitrary<T>::IsDefaultArbitrary)
+RC_SFINAE_TRAIT(HasFlatArbitrary,
+                decltype(FlatArbitrary<T>::generate(
+                    std::declval<const Random &>(), 0)))
+
+/// Whether arbitrary containers of `T` can store their elements flat, i.e. the
+/// arbitrary generator for `T` has not been customized and there is a
+/// `FlatArbitrary` for it.
+template <typename T>
+using IsFlatElement =
+    std::integral_constant<bool,
+                           IsDefaultArbitrary<T>::value &&
+                               HasFlatArbitrary<T>::value>;
 
 template <typename T>
 using Shrinkables = std::vector<Shrinkable<T>>;
@@ -26,6 +43,21 @@ Container toContainer(const Shrinkables<T> &shrinkables) {
                    makeShrinkValueIterator(end(shrinkables)));
 }
 
+/// Returns shrinks that remove elements from the given container, using
+/// `shrink::ddmin` for large containers since `shrink::removeChunks` yields too
+/// many shrinks for those.
+template <typename Container>
+Seq<Container> removeElements(Container elements) {
+  const auto threshold =
+      rc::detail::ImplicitParam<param::DdminThreshold>::value();
+  if ((threshold > 0) &&
+      (elements.size() >= static_cast<std::size_t>(threshold))) {
+    return shrink::ddmin(std::move(elements));
+  }
+
+  return shrink::removeChunks(std::move(elements));
+}
+
 template <typename T, typename Predicate>
 Shrinkables<T> generateShrinkables(const Random &random,
                                    int size,
@@ -300,12 +332,12 @@ public:
 
     using Elements = decltype(shrinkables);
     return shrinkable::map(
-        shrinkable::shrinkRecur(std::move(shrinkables),
-                                [=](const Elements &elements) {
-                                  return seq::concat(
-                                      shrink::removeChunks(elements),
-                                      strategy.shrinkElements(elements));
-                                }),
+        shrinkRecurUnlessValuesOnly(std::move(shrinkables),
+                                    [=](const Elements &elements) {
+                                      return seq::concat(
+                                          removeElements(elements),
+                                          strategy.shrinkElements(elements));
+                                    }),
         &toContainer<Container, typename Elements::value_type::ValueType>);
   }
 
@@ -319,10 +351,10 @@ public:
 
     using Elements = decltype(shrinkables);
     return shrinkable::map(
-        shrinkable::shrinkRecur(std::move(shrinkables),
-                                [=](const Elements &elements) {
-                                  return strategy.shrinkElements(elements);
-                                }),
+        shrinkRecurUnlessValuesOnly(std::move(shrinkables),
+                                    [=](const Elements &elements) {
+                                      return strategy.shrinkElements(elements);
+                                    }),
         &toContainer<Container, typename Elements::value_type::ValueType>);
   }
 
@@ -345,10 +377,10 @@ public:
     auto shrinkables = strategy.generateElements(random, size, N, gen);
 
     return shrinkable::map(
-        shrinkable::shrinkRecur(std::move(shrinkables),
-                                [=](const Shrinkables<U> &elements) {
-                                  return strategy.shrinkElements(elements);
-                                }),
+        shrinkRecurUnlessValuesOnly(std::move(shrinkables),
+                                    [=](const Shrinkables<U> &elements) {
+                                      return strategy.shrinkElements(elements);
+                                    }),
         [](const Shrinkables<U> &elements) {
           Array array;
           for (std::size_t i = 0; i < N; i++) {
@@ -374,38 +406,92 @@ private:
   Strategy m_strategy;
 };
 
+/// Generates the same containers as `gen::container(gen::arbitrary<T>())` for
+/// sequence containers of `T` with a `FlatArbitrary`. The elements are stored
+/// contiguously in a single vector instead of as one `Shrinkable` each and
+/// element shrinks are derived from the values themselves. This makes large
+/// containers of simple values much cheaper to generate and to shrink.
+template <typename Container>
+class FlatContainerGen {
+public:
+  using T = typename Container::value_type;
+  using Elements = std::vector<T>;
+
+  Shrinkable<Container> operator()(const Random &random, int size) const {
+    auto r = random;
+    std::size_t count = r.split().next() % (size + 1);
+    Elements elements;
+    elements.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+      elements.push_back(FlatArbitrary<T>::generate(r.split(), size));
+    }
+
+    return fromElements(
+        shrinkRecurUnlessValuesOnly(
+            std::move(elements),
+            [](const Elements &elements) {
+              return seq::concat(
+                  removeElements(elements),
+                  shrink::eachElement(elements, &FlatArbitrary<T>::shrink));
+            }),
+        std::is_same<Container, Elements>());
+  }
+
+private:
+  static Shrinkable<Container> fromElements(Shrinkable<Elements> s,
+                                            std::true_type) {
+    return s;
+  }
+
+  static Shrinkable<Container> fromElements(Shrinkable<Elements> s,
+                                            std::false_type) {
+    return shrinkable::map(std::move(s),
+                           [](const Elements &elements) {
+                             return Container(begin(elements), end(elements));
+                           });
+  }
+};
+
+template <typename Container>
+Gen<Container> arbitrarySequence(std::true_type) {
+  return FlatContainerGen<Container>();
+}
+
+template <typename Container>
+Gen<Container> arbitrarySequence(std::false_type) {
+  return gen::container<Container>(
+      gen::arbitrary<typename Container::value_type>());
+}
+
 // MSVC HACK: there used to be a really nice macro and template solution here
 // that doesn't work with MSVC
 
 template <typename T, typename Allocator>
 struct DefaultArbitrary<std::vector<T, Allocator>> {
   static Gen<std::vector<T, Allocator>> arbitrary() {
-    return gen::container<std::vector<T, Allocator>>(
-        gen::arbitrary<T>());
+    return arbitrarySequence<std::vector<T, Allocator>>(IsFlatElement<T>());
   }
 };
 
 template <typename T, typename Allocator>
 struct DefaultArbitrary<std::deque<T, Allocator>> {
   static Gen<std::deque<T, Allocator>> arbitrary() {
-    return gen::container<std::deque<T, Allocator>>(
-        gen::arbitrary<T>());
+    return arbitrarySequence<std::deque<T, Allocator>>(IsFlatElement<T>());
   }
 };
 
 template <typename T, typename Allocator>
 struct DefaultArbitrary<std::forward_list<T, Allocator>> {
   static Gen<std::forward_list<T, Allocator>> arbitrary() {
-    return gen::container<std::forward_list<T, Allocator>>(
-        gen::arbitrary<T>());
+    return arbitrarySequence<std::forward_list<T, Allocator>>(
+        IsFlatElement<T>());
   }
 };
 
 template <typename T, typename Allocator>
 struct DefaultArbitrary<std::list<T, Allocator>> {
   static Gen<std::list<T, Allocator>> arbitrary() {
-    return gen::container<std::list<T, Allocator>>(
-        gen::arbitrary<T>());
+    return arbitrarySequence<std::list<T, Allocator>>(IsFlatElement<T>());
   }
 };
 
@@ -4,17 +4,22 @@
 #include "rapidcheck/shrinkable/Create.h"
 #include "rapidcheck/shrink/Shrink.h"
 #include "rapidcheck/gen/Transform.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
 #include "rapidcheck/gen/detail/ScaleInteger.h"
 
 namespace rc {
 namespace gen {
 namespace detail {
 
+template <typename T>
+T integralValue(const Random &random, int size) {
+  return rc::detail::bitStreamOf(random).nextWithSize<T>(size);
+}
+
 template <typename T>
 Shrinkable<T> integral(const Random &random, int size) {
-  return shrinkable::shrinkRecur(
-      rc::detail::bitStreamOf(random).nextWithSize<T>(size),
-      &shrink::integral<T>);
+  return shrinkRecurUnlessValuesOnly(integralValue<T>(random, size),
+                                     &shrink::integral<T>);
 }
 
 extern template Shrinkable<char> integral<char>(const Random &random, int size);
@@ -36,7 +41,7 @@ extern template Shrinkable<unsigned long long>
 integral<unsigned long long>(const Random &random, int size);
 
 template <typename T>
-Shrinkable<T> real(const Random &random, int size) {
+T realValue(const Random &random, int size) {
   // TODO this implementation sucks
   auto stream = rc::detail::bitStreamOf(random);
   const double scale =
@@ -44,13 +49,19 @@ Shrinkable<T> real(const Random &random, int size) {
   const double a = static_cast<double>(stream.nextWithSize<int64_t>(size));
   const double b =
       (stream.next<uint64_t>() * scale) / static_cast<double>(std::numeric_limits<uint64_t>::max());
-  const T value = static_cast<T>(a + b);
-  return shrinkable::shrinkRecur(value, &shrink::real<T>);
+  return static_cast<T>(a + b);
+}
+
+template <typename T>
+Shrinkable<T> real(const Random &random, int size) {
+  return shrinkRecurUnlessValuesOnly(realValue<T>(random, size),
+                                     &shrink::real<T>);
 }
 
 extern template Shrinkable<float> real<float>(const Random &random, int size);
 extern template Shrinkable<double> real<double>(const Random &random, int size);
 
+bool booleanValue(const Random &random, int size);
 Shrinkable<bool> boolean(const Random &random, int size);
 
 template <typename T>
@@ -85,6 +96,44 @@ struct DefaultArbitrary<bool> {
   static Gen<bool> arbitrary() { return boolean; }
 };
 
+/// Generates and shrinks the same values as `DefaultArbitrary<T>` but without
+/// wrapping each of them in a `Shrinkable`. This lets containers of such values
+/// store them flat.
+template <typename T, typename = void>
+struct FlatArbitrary {};
+
+template <typename T>
+struct FlatArbitrary<
+    T,
+    typename std::enable_if<std::is_integral<T>::value &&
+                            !std::is_same<T, bool>::value>::type> {
+  static T generate(const Random &random, int size) {
+    return integralValue<T>(random, size);
+  }
+
+  static Seq<T> shrink(T value) { return rc::shrink::integral<T>(value); }
+};
+
+template <typename T>
+struct FlatArbitrary<
+    T,
+    typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static T generate(const Random &random, int size) {
+    return realValue<T>(random, size);
+  }
+
+  static Seq<T> shrink(T value) { return rc::shrink::real<T>(value); }
+};
+
+template <>
+struct FlatArbitrary<bool> {
+  static bool generate(const Random &random, int size) {
+    return booleanValue(random, size);
+  }
+
+  static Seq<bool> shrink(bool value) { return rc::shrink::boolean(value); }
+};
+
 } // namespace detail
 
 template <typename T>
@@ -105,7 +154,7 @@ Gen<T> inRange(T min, T max) {
     const auto value =
         static_cast<T>((Random(random).next() % rangeSize) + min);
     assert(value >= min && value < max);
-    return shrinkable::shrinkRecur(
+    return detail::shrinkRecurUnlessValuesOnly(
         value, [=](T x) { return shrink::towards<T>(x, min); });
   };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "rapidcheck/detail/FrequencyMap.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
 #include "rapidcheck/gen/detail/ScaleInteger.h"
 
 namespace rc {
@@ -100,7 +101,7 @@ public:
     const auto max = detail::scaleInteger(m_container.size() - 1, size) + 1;
     const auto container = m_container;
     return shrinkable::map(
-        shrinkable::shrinkRecur(
+        shrinkRecurUnlessValuesOnly(
             static_cast<std::size_t>(Random(random).next() % max),
             [](std::size_t x) { return shrink::towards<std::size_t>(x, 0); }),
         [=](std::size_t x) { return container[x]; });
@@ -4,6 +4,7 @@
 
 #include "rapidcheck/detail/BitStream.h"
 #include "rapidcheck/gen/Container.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
 
 namespace rc {
 namespace gen {
@@ -32,10 +33,10 @@ public:
       str.push_back(value);
     }
 
-    return shrinkable::shrinkRecur(
+    return shrinkRecurUnlessValuesOnly(
         std::move(str),
         [](const String &s) {
-          return seq::concat(shrink::removeChunks(s),
+          return seq::concat(removeElements(s),
                              shrink::eachElement(s, &shrink::character<T>));
         });
   }
@@ -60,7 +61,7 @@ Gen<T> character() {
       // Do nothing
     }
 
-    return shrinkable::shrinkRecur(value, &shrink::character<T>);
+    return detail::shrinkRecurUnlessValuesOnly(value, &shrink::character<T>);
   };
 }
 
@@ -16,8 +16,8 @@ public:
 private:
   Recipe &m_recipe;
   Random m_random;
-  using Iterator = Recipe::Ingredients::iterator;
-  Iterator m_it;
+  bool m_valuesOnly;
+  std::size_t m_next;
 };
 
 } // namespace detail
@@ -3,6 +3,7 @@
 #include "rapidcheck/shrinkable/Create.h"
 #include "rapidcheck/gen/Tuple.h"
 #include "rapidcheck/gen/detail/ExecHandler.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
 
 namespace rc {
 namespace gen {
@@ -28,6 +29,10 @@ execWithRecipe(Callable callable, Recipe recipe) {
   Recipe resultRecipe(recipe);
   ExecHandler handler(resultRecipe);
   ImplicitParam<param::CurrentHandler> letHandler(&handler);
+  ImplicitParam<param::CurrentRecipe> letRecipe(&recipe);
+  // Only the values generated through the handler may skip their shrinks, the
+  // callable itself might call generators directly and expect shrinks
+  ImplicitParam<param::ValuesOnly> letValuesOnly(false);
 
   return std::make_pair(execWithArguments(callable, ArgTypes<Callable>()),
                         std::move(resultRecipe));
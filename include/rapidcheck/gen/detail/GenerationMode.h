@@ -0,0 +1,54 @@
+#pragma once
+
+#include "rapidcheck/Shrinkable.h"
+#include "rapidcheck/detail/ImplicitParam.h"
+#include "rapidcheck/shrinkable/Create.h"
+
+namespace rc {
+namespace gen {
+namespace detail {
+
+namespace param {
+
+/// Whether the values produced by generators will never be shrunk. Generators
+/// can then return a `Shrinkable` without shrinks instead of building up shrink
+/// state that is never used. The values themselves must be the same in both
+/// modes so that a failure can still be reproduced from the `Random` and size
+/// alone.
+///
+/// When bound around a property, this only applies to the values that the
+/// property generates through `operator*` or its arguments. The property
+/// itself is always run with this disabled.
+struct ValuesOnly {
+  using ValueType = bool;
+  static bool defaultValue();
+};
+
+/// Containers and strings with at least this many elements are shrunk using
+/// `shrink::ddmin`, see `TestParams::ddminThreshold`. `0` means never.
+struct DdminThreshold {
+  using ValueType = int;
+  static int defaultValue();
+};
+
+} // namespace param
+
+/// Equivalent to `shrinkable::shrinkRecur` unless only values are needed, in
+/// which case the value is returned without shrinks.
+///
+/// A `Shrinkable` always refers to a heap allocated implementation so the
+/// value still takes one allocation, the same as the root of `shrinkRecur`.
+/// What is saved is keeping the shrink function around and ever producing the
+/// shrinks. With `pool_allocation`, the allocation itself is reused.
+template <typename T, typename Shrink>
+Shrinkable<Decay<T>> shrinkRecurUnlessValuesOnly(T &&value,
+                                                 const Shrink &shrinkf) {
+  if (rc::detail::ImplicitParam<param::ValuesOnly>::value()) {
+    return shrinkable::just(std::forward<T>(value));
+  }
+  return shrinkable::shrinkRecur(std::forward<T>(value), shrinkf);
+}
+
+} // namespace detail
+} // namespace gen
+} // namespace rc
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "rapidcheck/Shrinkable.h"
@@ -17,11 +18,17 @@ namespace detail {
 struct Recipe {
   struct Ingredient {
     Ingredient(std::string &&d, Shrinkable<rc::detail::Any> &&s)
+        : description(std::make_shared<const std::string>(std::move(d)))
+        , shrinkable(std::move(s)) {}
+
+    Ingredient(std::shared_ptr<const std::string> d,
+               Shrinkable<rc::detail::Any> &&s)
         : description(std::move(d))
         , shrinkable(std::move(s)) {}
 
-    /// A description of the shrinkable value.
-    std::string description;
+    /// A description of the shrinkable value. Shared with the shrinks of this
+    /// ingredient.
+    std::shared_ptr<const std::string> description;
 
     // The shrinkable value itself.
     Shrinkable<rc::detail::Any> shrinkable;
@@ -33,17 +40,45 @@ struct Recipe {
     }
   };
 
-  using Ingredients = std::vector<Ingredient>;
+  /// Ingredients are never modified once created. They are shared between
+  /// recipes, so copying a recipe or shrinking one does not copy every
+  /// ingredient.
+  using IngredientPtr = std::shared_ptr<const Ingredient>;
+  using Ingredients = std::vector<IngredientPtr>;
 
   Random random;
   int size = 0;
-  Ingredients ingredients;
+  /// Ingredients shared with other recipes, typically the one that this recipe
+  /// was shrunk from. Only the first `numShared` of them belong to this recipe.
+  std::shared_ptr<const Ingredients> shared;
+  std::size_t numShared = 0;
+  /// The ingredients that follow the shared ones.
+  Ingredients added;
   std::size_t numFixed = 0;
+
+  /// Returns the total number of ingredients.
+  std::size_t numIngredients() const { return numShared + added.size(); }
+
+  /// Returns the ingredient at the given index.
+  const IngredientPtr &ingredient(std::size_t i) const {
+    return (i < numShared) ? (*shared)[i] : added[i - numShared];
+  }
 };
 
 /// Returns the non-recursive shrinks for the given recipe.
 Seq<Recipe> shrinkRecipe(const Recipe &recipe);
 
+namespace param {
+
+/// The recipe that the innermost `execRaw` evaluation was started with, before
+/// any new ingredients were added.
+struct CurrentRecipe {
+  using ValueType = const Recipe *;
+  static const Recipe *defaultValue();
+};
+
+} // namespace param
+
 } // namespace detail
 } // namespace gen
 } // namespace rc
@@ -16,6 +16,18 @@ namespace shrink {
 template <typename Container>
 Seq<Container> removeChunks(Container elements);
 
+/// Tries to shrink the given container by delta debugging (ddmin). The
+/// container is split into two chunks, then four, then eight and so on until
+/// each chunk is a single element. On each level, every chunk is first tried on
+/// its own and then every chunk is tried removed. The number of shrinks is
+/// linear in the size of the container as opposed to `removeChunks` which
+/// yields a quadratic number of shrinks. Every shrink that removes a single
+/// element is still tried.
+///
+/// `Container` has the same requirements as for `removeChunks`.
+template <typename Container>
+Seq<Container> ddmin(Container elements);
+
 /// Tries to shrink each element of the given container using the given
 /// callable to create sequences of shrinks for that element.
 ///
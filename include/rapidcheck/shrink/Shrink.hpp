@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <locale>
 
@@ -73,6 +74,73 @@ private:
   std::size_t m_size;
 };
 
+template <typename Container>
+class DdminSeq {
+public:
+  template <typename ContainerArg>
+  explicit DdminSeq(ContainerArg &&elements)
+      : m_elements(std::forward<ContainerArg>(elements))
+      , m_numChunks(0)
+      , m_i(0)
+      , m_complements(false) {}
+
+  Maybe<Container> operator()() {
+    const auto n = m_elements.size();
+    if (m_numChunks == 0) {
+      // Like `removeChunks`, start by trying to remove everything
+      if (n == 0) {
+        return Nothing;
+      }
+      m_numChunks = 2;
+      return Container();
+    }
+
+    while (m_numChunks <= n) {
+      if (m_i < m_numChunks) {
+        const auto i = m_i++;
+        const auto start = (i * n) / m_numChunks;
+        const auto fin = ((i + 1) * n) / m_numChunks;
+        return m_complements ? without(start, fin) : slice(start, fin);
+      }
+
+      m_i = 0;
+      // With two chunks, the complements are the chunks themselves
+      if (!m_complements && (m_numChunks > 2)) {
+        m_complements = true;
+      } else {
+        m_complements = false;
+        m_numChunks = (m_numChunks < n) ? std::min(m_numChunks * 2, n)
+                                        : (n + 1);
+      }
+    }
+
+    return Nothing;
+  }
+
+private:
+  Container slice(std::size_t start, std::size_t fin) const {
+    Container elements;
+    elements.reserve(fin - start);
+    elements.insert(
+        end(elements), begin(m_elements) + start, begin(m_elements) + fin);
+    return elements;
+  }
+
+  Container without(std::size_t start, std::size_t fin) const {
+    Container elements;
+    elements.reserve(m_elements.size() - (fin - start));
+    elements.insert(
+        end(elements), begin(m_elements), begin(m_elements) + start);
+    elements.insert(end(elements), begin(m_elements) + fin, end(m_elements));
+    return elements;
+  }
+
+  Container m_elements;
+  std::size_t m_numChunks;
+  std::size_t m_i;
+  bool m_complements;
+};
+
 template <typename Container, typename Shrink>
 class EachElementSeq {
 public:
@@ -144,6 +212,11 @@ Seq<Container> removeChunks(Container elements) {
   return makeSeq<detail::RemoveChunksSeq<Container>>(std::move(elements));
 }
 
+template <typename Container>
+Seq<Container> ddmin(Container elements) {
+  return makeSeq<detail::DdminSeq<Container>>(std::move(elements));
+}
+
 template <typename Container, typename Shrink>
 Seq<Container> eachElement(Container elements, Shrink shrink) {
   return makeSeq<detail::EachElementSeq<Container, Shrink>>(std::move(elements),
@@ -4,6 +4,9 @@
 
 #include "rapidcheck/state/Command.h"
 #include "rapidcheck/state/Commands.h"
+#include "rapidcheck/state/Parallel.h"
+#include "rapidcheck/state/Snapshots.h"
 #include "rapidcheck/state/State.h"
+#include "rapidcheck/state/SutPool.h"
 #include "rapidcheck/state/gen/Commands.h"
 #include "rapidcheck/state/gen/ExecCommands.h"
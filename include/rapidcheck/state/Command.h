@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 namespace rc {
 namespace state {
 
@@ -31,6 +33,16 @@ public:
   /// properly.
   virtual void run(const Model &s0, Sut &sut) const;
 
+  /// Applies this command to the given system under test without knowing its
+  /// state since other commands may be running concurrently. Used by
+  /// `checkParallel`. Returns a callable which checks what the command
+  /// observed against a model state using rapidcheck assertion macros. It may
+  /// be called several times with different states.
+  ///
+  /// Default implementation throws since this must be implemented for commands
+  /// to be used with `checkParallel`.
+  virtual std::function<void(const Model &)> runConcurrently(Sut &sut) const;
+
   /// Outputs a human readable representation of the command to the given
   /// output stream.
   virtual void show(std::ostream &os) const;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdexcept>
+
 #include "rapidcheck/detail/Platform.h"
 #include "rapidcheck/detail/ShowType.h"
 
@@ -15,6 +17,13 @@ void Command<Model, Sut>::apply(Model &s0) const {}
 template <typename Model, typename Sut>
 void Command<Model, Sut>::run(const Model &s0, Sut &sut) const {}
 
+template <typename Model, typename Sut>
+std::function<void(const Model &)>
+Command<Model, Sut>::runConcurrently(Sut &sut) const {
+  throw std::logic_error(
+      "Command::runConcurrently must be implemented to use checkParallel");
+}
+
 template <typename Model, typename Sut>
 void Command<Model, Sut>::show(std::ostream &os) const {
 #ifndef RC_DONT_USE_RTTI
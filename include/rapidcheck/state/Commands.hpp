@@ -1,9 +1,56 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+
+#include "rapidcheck/detail/CommandStats.h"
 #include "rapidcheck/detail/Results.h"
 
 namespace rc {
 namespace state {
+namespace detail {
+
+template <typename Cmd>
+void recordRun(::rc::detail::CommandStatsRecorder &recorder,
+               const Cmd &command,
+               std::chrono::steady_clock::time_point start) {
+  const auto nanos = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+#ifndef RC_DONT_USE_RTTI
+  recorder.record(typeid(command), nanos);
+#else
+  std::ostringstream ss;
+  command.show(ss);
+  recorder.record(ss.str(), nanos);
+#endif // RC_DONT_USE_RTTI
+}
+
+/// Runs the given command, recording how long it takes if there is a current
+/// `CommandStatsRecorder`.
+template <typename Cmd>
+void runCommand(const Cmd &command,
+                const typename Cmd::Model &state,
+                typename Cmd::Sut &sut) {
+  const auto recorder = ::rc::detail::CommandStatsRecorder::current();
+  if (recorder == nullptr) {
+    command.run(state, sut);
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    command.run(state, sut);
+  } catch (...) {
+    recordRun(*recorder, command, start);
+    throw;
+  }
+  recordRun(*recorder, command, start);
+}
+
+} // namespace detail
 
 template <typename Cmds, typename Model>
 void applyAll(const Cmds &commands, Model &state) {
@@ -27,7 +74,7 @@ void runAll(const Cmds &commands,
   auto currentState = makeInitialState();
   for (const auto &command : commands) {
     command->checkPreconditions(currentState);
-    command->run(currentState, sut);
+    detail::runCommand(*command, currentState, sut);
     command->apply(currentState);
   }
 }
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+#include "rapidcheck/state/Commands.h"
+
+namespace rc {
+namespace state {
+
+/// Options for parallel testing of stateful systems.
+struct ParallelOptions {
+  /// The number of threads to run commands on concurrently.
+  int numThreads = 2;
+
+  /// The maximum number of commands that each thread runs.
+  int maxCommandsPerThread = 20;
+};
+
+/// A program for parallel testing: a sequence of commands that is run first,
+/// followed by one sequence of commands per thread that are run concurrently.
+template <typename Cmd>
+struct ParallelCommands {
+  /// The commands that are run sequentially first.
+  Commands<Cmd> prefix;
+
+  /// The commands that are run concurrently, one sequence per thread.
+  std::vector<Commands<Cmd>> suffixes;
+};
+
+/// Tests a concurrent system. First runs a sequence of commands like `check`
+/// and then runs a sequence of commands on each of several threads at the same
+/// time using `Command::runConcurrently`. Fails unless the results of the
+/// concurrent commands agree with the model for some order of the commands
+/// that is consistent with how they actually ran. Like `check`, this has
+/// assertion semantics and is intended to be used from a property.
+///
+/// @param initialState    The initial model state.
+/// @param sut             The system under test. Must be safe to use from
+///                        several threads at once.
+/// @param generationFunc  A callable which takes the current model state as a
+///                        parameter and returns a generator for a (possibly)
+///                        suitable command.
+/// @param options         The options to use.
+template <typename Model, typename Sut, typename GenFunc>
+void checkParallel(const Model &initialState,
+                   Sut &sut,
+                   GenFunc &&generationFunc,
+                   const ParallelOptions &options = ParallelOptions());
+
+/// Runs the given parallel commands on the given system under test and checks
+/// that the results of the concurrent commands are linearizable with respect
+/// to the model. Fails if they are not. Discards the test case if no order of
+/// the concurrent commands satisfies their preconditions.
+template <typename Cmd>
+void runParallel(const ParallelCommands<Cmd> &commands,
+                 const typename Cmd::Model &initialState,
+                 typename Cmd::Sut &sut);
+
+namespace gen {
+
+/// Generates parallel commands for the given initial state. Every sequence of
+/// concurrent commands is valid for the state after the sequential commands
+/// but not necessarily when interleaved with the other sequences.
+template <typename Model, typename GenerationFunc>
+auto parallelCommands(const Model &initialState,
+                      GenerationFunc &&genFunc,
+                      const ParallelOptions &options = ParallelOptions())
+    -> Gen<ParallelCommands<
+        typename decltype(genFunc(initialState))::ValueType::element_type::
+            CommandType>>;
+
+} // namespace gen
+} // namespace state
+} // namespace rc
+
+#include "Parallel.hpp"
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "rapidcheck/gen/Container.h"
+#include "rapidcheck/gen/Exec.h"
+#include "rapidcheck/gen/Transform.h"
+#include "rapidcheck/state/State.h"
+#include "rapidcheck/state/detail/LinearizabilityChecker.h"
+
+namespace rc {
+namespace state {
+namespace detail {
+
+/// Runs each sequence of commands on its own thread and records the history.
+template <typename Cmd>
+ConcurrentHistory<Cmd>
+runConcurrently(const std::vector<Commands<Cmd>> &suffixes,
+                typename Cmd::Sut &sut) {
+  const auto numThreads = suffixes.size();
+  ConcurrentHistory<Cmd> history(numThreads);
+  std::vector<std::exception_ptr> errors(numThreads);
+  std::atomic<std::uint64_t> clock(0);
+  std::atomic<std::size_t> numReady(0);
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads);
+  for (std::size_t i = 0; i < numThreads; i++) {
+    threads.emplace_back([&, i] {
+      // Start all threads at the same time to make them overlap as much as
+      // possible
+      numReady++;
+      while (numReady.load() < numThreads) {
+        std::this_thread::yield();
+      }
+
+      try {
+        for (const auto &command : suffixes[i]) {
+          ConcurrentOperation<Cmd> operation;
+          operation.command = command;
+          operation.invoked = clock++;
+          operation.verify = command->runConcurrently(sut);
+          operation.returned = clock++;
+          history[i].push_back(std::move(operation));
+        }
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  return history;
+}
+
+} // namespace detail
+
+template <typename Model, typename Sut, typename GenFunc>
+void checkParallel(const Model &initialState,
+                   Sut &sut,
+                   GenFunc &&generationFunc,
+                   const ParallelOptions &options) {
+  const auto commands = *gen::parallelCommands(
+      initialState, std::forward<GenFunc>(generationFunc), options);
+  runParallel(commands, initialState, sut);
+}
+
+template <typename Cmd>
+void runParallel(const ParallelCommands<Cmd> &commands,
+                 const typename Cmd::Model &initialState,
+                 typename Cmd::Sut &sut) {
+  runAll(commands.prefix, initialState, sut);
+  auto state = initialState;
+  applyAll(commands.prefix, state);
+
+  const auto history = detail::runConcurrently(commands.suffixes, sut);
+  detail::LinearizabilityChecker<Cmd> checker(history);
+  switch (checker.check(state)) {
+  case detail::LinearizabilityChecker<Cmd>::Result::Linearizable:
+    break;
+
+  case detail::LinearizabilityChecker<Cmd>::Result::NoValidOrder:
+    RC_DISCARD("No order of the concurrent commands satisfies their "
+               "preconditions");
+
+  case detail::LinearizabilityChecker<Cmd>::Result::NotLinearizable:
+    throw ::rc::detail::CaseResult(
+        ::rc::detail::CaseResult::Type::Failure,
+        "No order of the concurrent commands agrees with the model. Last "
+        "disagreement:\n\n" +
+            checker.failureDescription());
+  }
+}
+
+template <typename Cmd>
+void showValue(const ParallelCommands<Cmd> &commands, std::ostream &os) {
+  os << "Sequential:" << std::endl;
+  showValue(commands.prefix, os);
+  for (std::size_t i = 0; i < commands.suffixes.size(); i++) {
+    os << std::endl << "Thread " << (i + 1) << ":" << std::endl;
+    showValue(commands.suffixes[i], os);
+  }
+}
+
+namespace gen {
+
+template <typename Model, typename GenerationFunc>
+auto parallelCommands(const Model &initialState,
+                      GenerationFunc &&genFunc,
+                      const ParallelOptions &options)
+    -> Gen<ParallelCommands<
+        typename decltype(genFunc(initialState))::ValueType::element_type::
+            CommandType>> {
+  using Cmd = typename decltype(
+      genFunc(initialState))::ValueType::element_type::CommandType;
+  using GenFunc = Decay<GenerationFunc>;
+  const GenFunc func(std::forward<GenerationFunc>(genFunc));
+
+  return rc::gen::exec([=] {
+    ParallelCommands<Cmd> result;
+    result.prefix = *commands(initialState, func);
+
+    auto state = initialState;
+    applyAll(result.prefix, state);
+    const auto maxSize = std::max(options.maxCommandsPerThread - 1, 0);
+    const auto suffixGen = rc::gen::withSize([=](int size) {
+      return rc::gen::resize(std::min(size, maxSize), commands(state, func));
+    });
+    result.suffixes = *rc::gen::container<std::vector<Commands<Cmd>>>(
+        static_cast<std::size_t>(options.numThreads), suffixGen);
+    return result;
+  });
+}
+
+} // namespace gen
+} // namespace state
+} // namespace rc
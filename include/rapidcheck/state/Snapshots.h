@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+#include "rapidcheck/state/Commands.h"
+
+namespace rc {
+namespace state {
+
+/// Options for resuming command sequences from snapshots.
+struct SnapshotOptions {
+  /// A snapshot is taken after every this many commands.
+  int interval = 16;
+
+  /// The maximum number of snapshots to keep for each combination of model
+  /// and system under test types. The least recently used snapshots are
+  /// dropped first.
+  int maxSnapshots = 64;
+};
+
+/// The number of commands that a run with snapshots executed and the number of
+/// commands it skipped by resuming from a snapshot.
+struct SnapshotStats {
+  std::uint64_t commandsRun = 0;
+  std::uint64_t commandsSkipped = 0;
+};
+
+/// Like `check` but takes snapshots of the model state and system under test
+/// every few commands. Later test cases whose commands start with the same
+/// commands as a snapshot resume from the latest such snapshot instead of
+/// running those commands again. This mostly helps shrinking where most
+/// candidates share a prefix with the failing sequence.
+///
+/// Snapshots are taken by copying the system under test, so `Sut` must be copy
+/// constructible and copy assignable. Commands are matched by identity, not by
+/// value. As a result, the system under test must be in the same state at the
+/// start of every test case. The initial model states are compared as well if
+/// `Model` is equality comparable.
+///
+/// @return The number of commands that were run and skipped.
+template <typename Model, typename Sut, typename GenFunc>
+SnapshotStats
+checkWithSnapshots(const Model &initialState,
+                   Sut &sut,
+                   GenFunc &&generationFunc,
+                   const SnapshotOptions &options = SnapshotOptions());
+
+/// Like `runAll` but resumes from and takes snapshots like
+/// `checkWithSnapshots`.
+template <typename Model, typename Sut>
+SnapshotStats
+runAllWithSnapshots(const Commands<Command<Model, Sut>> &commands,
+                    const Model &initialState,
+                    Sut &sut,
+                    const SnapshotOptions &options = SnapshotOptions());
+
+/// Drops all snapshots for the given model and system under test types.
+template <typename Model, typename Sut>
+void clearSnapshots();
+
+} // namespace state
+} // namespace rc
+
+#include "Snapshots.hpp"
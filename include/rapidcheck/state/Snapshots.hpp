@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+
+#include "rapidcheck/gen/Exec.h"
+#include "rapidcheck/state/detail/SnapshotCache.h"
+#include "rapidcheck/state/gen/Commands.h"
+
+namespace rc {
+namespace state {
+
+template <typename Model, typename Sut, typename GenFunc>
+SnapshotStats checkWithSnapshots(const Model &initialState,
+                                 Sut &sut,
+                                 GenFunc &&generationFunc,
+                                 const SnapshotOptions &options) {
+  const auto commands =
+      *gen::commands(initialState, std::forward<GenFunc>(generationFunc));
+  return runAllWithSnapshots(commands, initialState, sut, options);
+}
+
+template <typename Model, typename Sut>
+SnapshotStats
+runAllWithSnapshots(const Commands<Command<Model, Sut>> &commands,
+                    const Model &initialState,
+                    Sut &sut,
+                    const SnapshotOptions &options) {
+  auto &cache = detail::snapshotCache<Model, Sut>();
+  const auto interval =
+      static_cast<std::size_t>(std::max(options.interval, 1));
+  const auto maxSnapshots =
+      static_cast<std::size_t>(std::max(options.maxSnapshots, 0));
+
+  SnapshotStats stats;
+  auto currentState = initialState;
+  const auto start = cache.restore(commands, initialState, currentState, sut);
+  stats.commandsSkipped = start;
+  for (std::size_t i = start; i < commands.size(); i++) {
+    const auto &command = commands[i];
+    command->checkPreconditions(currentState);
+    detail::runCommand(*command, currentState, sut);
+    command->apply(currentState);
+    stats.commandsRun++;
+
+    const auto length = i + 1;
+    if (((length % interval) == 0) && (length < commands.size())) {
+      cache.add(
+          commands, length, initialState, currentState, sut, maxSnapshots);
+    }
+  }
+
+  return stats;
+}
+
+template <typename Model, typename Sut>
+void clearSnapshots() {
+  detail::snapshotCache<Model, Sut>().clear();
+}
+
+} // namespace state
+} // namespace rc
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace rc {
+namespace state {
+
+/// How many systems under test a `SutPool` has constructed and reset.
+struct SutPoolStats {
+  /// The number of systems under test that were constructed.
+  std::uint64_t constructions = 0;
+
+  /// The number of times that a system under test was reset and reused.
+  std::uint64_t resets = 0;
+
+  /// The number of resets that threw. A new system under test is constructed
+  /// instead.
+  std::uint64_t failedResets = 0;
+};
+
+/// A pool of systems under test that are reused across test cases and shrink
+/// steps instead of being constructed for every one of them. Systems under
+/// test are reset before they are reused. Safe to use from several threads.
+template <typename Sut>
+class SutPool {
+public:
+  using Factory = std::function<std::unique_ptr<Sut>()>;
+  using Reset = std::function<void(Sut &)>;
+
+  /// A system under test that is borrowed from a pool. Returns it to the pool
+  /// when destroyed so the pool must outlive it.
+  class Lease {
+  public:
+    Lease(Lease &&other) noexcept;
+    Lease &operator=(Lease &&other) = delete;
+    ~Lease();
+
+    Sut &operator*() const { return *m_sut; }
+    Sut *operator->() const { return m_sut.get(); }
+
+  private:
+    friend class SutPool;
+    Lease(SutPool &pool, std::unique_ptr<Sut> sut);
+
+    SutPool *m_pool;
+    std::unique_ptr<Sut> m_sut;
+  };
+
+  /// Creates a pool which constructs systems under test using `factory` and
+  /// resets them using `reset`. If `reset` throws, the system under test is
+  /// thrown away and a new one is constructed instead. If no `reset` is given,
+  /// systems under test are never reused.
+  explicit SutPool(Factory factory, Reset reset = Reset());
+
+  /// Borrows a system under test from the pool, resetting an idle one if
+  /// there is one and constructing a new one otherwise.
+  Lease acquire();
+
+  /// Returns the number of constructions and resets so far.
+  SutPoolStats stats() const;
+
+private:
+  void release(std::unique_ptr<Sut> sut);
+
+  Factory m_factory;
+  Reset m_reset;
+  mutable std::mutex m_mutex;
+  std::vector<std::unique_ptr<Sut>> m_idle;
+  SutPoolStats m_stats;
+};
+
+/// Equivalent to `check(Model, Sut, GenFunc)` but borrows the system under
+/// test from the given pool.
+template <typename Model, typename Sut, typename GenFunc>
+void check(const Model &initialState,
+           SutPool<Sut> &pool,
+           GenFunc &&generationFunc);
+
+/// Equivalent to `check(MakeInitialState, Sut, GenFunc)` but borrows the
+/// system under test from the given pool.
+template <typename MakeInitialState,
+          typename Sut,
+          typename GenFunc,
+          typename = decltype(
+              std::declval<GenFunc>()(std::declval<MakeInitialState>()()))>
+void check(MakeInitialState &&makeInitialState,
+           SutPool<Sut> &pool,
+           GenFunc &&generationFunc);
+
+} // namespace state
+} // namespace rc
+
+#include "SutPool.hpp"
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "rapidcheck/state/State.h"
+
+namespace rc {
+namespace state {
+
+template <typename Sut>
+SutPool<Sut>::Lease::Lease(SutPool &pool, std::unique_ptr<Sut> sut)
+    : m_pool(&pool)
+    , m_sut(std::move(sut)) {}
+
+template <typename Sut>
+SutPool<Sut>::Lease::Lease(Lease &&other) noexcept
+    : m_pool(other.m_pool)
+    , m_sut(std::move(other.m_sut)) {}
+
+template <typename Sut>
+SutPool<Sut>::Lease::~Lease() {
+  if (m_sut) {
+    m_pool->release(std::move(m_sut));
+  }
+}
+
+template <typename Sut>
+SutPool<Sut>::SutPool(Factory factory, Reset reset)
+    : m_factory(std::move(factory))
+    , m_reset(std::move(reset)) {}
+
+template <typename Sut>
+typename SutPool<Sut>::Lease SutPool<Sut>::acquire() {
+  std::unique_ptr<Sut> sut;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_idle.empty()) {
+      sut = std::move(m_idle.back());
+      m_idle.pop_back();
+    }
+  }
+
+  if (sut) {
+    bool wasReset = false;
+    try {
+      m_reset(*sut);
+      wasReset = true;
+    } catch (...) {
+      sut.reset();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (wasReset) {
+      m_stats.resets++;
+      return Lease(*this, std::move(sut));
+    }
+    m_stats.failedResets++;
+  }
+
+  sut = m_factory();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_stats.constructions++;
+  return Lease(*this, std::move(sut));
+}
+
+template <typename Sut>
+SutPoolStats SutPool<Sut>::stats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+template <typename Sut>
+void SutPool<Sut>::release(std::unique_ptr<Sut> sut) {
+  if (!m_reset) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_idle.push_back(std::move(sut));
+}
+
+template <typename Model, typename Sut, typename GenFunc>
+void check(const Model &initialState,
+           SutPool<Sut> &pool,
+           GenFunc &&generationFunc) {
+  check(
+      fn::constant(initialState), pool, std::forward<GenFunc>(generationFunc));
+}
+
+template <typename MakeInitialState, typename Sut, typename GenFunc, typename>
+void check(MakeInitialState &&makeInitialState,
+           SutPool<Sut> &pool,
+           GenFunc &&generationFunc) {
+  const auto lease = pool.acquire();
+  check(std::forward<MakeInitialState>(makeInitialState),
+        *lease,
+        std::forward<GenFunc>(generationFunc));
+}
+
+} // namespace state
+} // namespace rc
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rapidcheck/detail/Traits.h"
+#include "rapidcheck/state/Command.h"
+
+namespace rc {
+namespace state {
+namespace detail {
+
+/// A command that was run concurrently together with what it observed and
+/// when it ran.
+template <typename Cmd>
+struct ConcurrentOperation {
+  /// The command.
+  std::shared_ptr<const Cmd> command;
+
+  /// Checks what the command observed against a model state.
+  std::function<void(const typename Cmd::Model &)> verify;
+
+  /// The logical time at which the command was invoked.
+  std::uint64_t invoked;
+
+  /// The logical time at which the command returned.
+  std::uint64_t returned;
+};
+
+/// The operations run by each thread, in the order that they ran.
+template <typename Cmd>
+using ConcurrentHistory = std::vector<std::vector<ConcurrentOperation<Cmd>>>;
+
+/// Searches for an order of the operations in a concurrent history that
+/// respects the order in which they actually ran and in which every operation
+/// is valid and agrees with the model. Operations that did not overlap in time
+/// must keep their order while overlapping ones may be reordered.
+///
+/// Model states that have already been explored at the same position in the
+/// history are not explored again if `Model` can be compared for equality.
+/// This keeps the search tractable for a handful of threads with a few tens of
+/// operations each.
+template <typename Cmd>
+class LinearizabilityChecker {
+public:
+  using Model = typename Cmd::Model;
+
+  enum class Result {
+    /// There is an order that is consistent with the model.
+    Linearizable,
+    /// Every order that satisfies the preconditions disagrees with the model.
+    NotLinearizable,
+    /// No order satisfies the preconditions of all operations.
+    NoValidOrder
+  };
+
+  explicit LinearizabilityChecker(const ConcurrentHistory<Cmd> &history);
+
+  /// Checks the history starting from the given model state.
+  Result check(const Model &initialState);
+
+  /// Returns the description of the last disagreement with the model that was
+  /// found, if any.
+  const std::string &failureDescription() const { return m_failure; }
+
+  /// Returns the number of model states that were explored by the last check.
+  std::size_t numExplored() const { return m_numExplored; }
+
+private:
+  using Positions = std::vector<std::size_t>;
+  using CanMemoize = ::rc::detail::IsEqualityComparable<Model>;
+
+  bool search(const Model &state);
+  bool canRunNext(std::size_t thread) const;
+  bool wasExplored(const Model &state, std::true_type) const;
+  bool wasExplored(const Model &state, std::false_type) const;
+  void markExplored(const Model &state, std::true_type);
+  void markExplored(const Model &state, std::false_type);
+
+  const ConcurrentHistory<Cmd> &m_history;
+  Positions m_positions;
+  std::map<Positions, std::vector<Model>> m_explored;
+  bool m_foundFailure;
+  std::string m_failure;
+  std::size_t m_numExplored;
+};
+
+} // namespace detail
+} // namespace state
+} // namespace rc
+
+#include "LinearizabilityChecker.hpp"
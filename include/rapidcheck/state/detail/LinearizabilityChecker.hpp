@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+
+#include "rapidcheck/detail/Results.h"
+#include "rapidcheck/state/State.h"
+
+namespace rc {
+namespace state {
+namespace detail {
+
+template <typename Cmd>
+LinearizabilityChecker<Cmd>::LinearizabilityChecker(
+    const ConcurrentHistory<Cmd> &history)
+    : m_history(history)
+    , m_foundFailure(false)
+    , m_numExplored(0) {}
+
+template <typename Cmd>
+typename LinearizabilityChecker<Cmd>::Result
+LinearizabilityChecker<Cmd>::check(const Model &initialState) {
+  m_positions.assign(m_history.size(), 0);
+  m_explored.clear();
+  m_foundFailure = false;
+  m_failure.clear();
+  m_numExplored = 0;
+
+  if (search(initialState)) {
+    return Result::Linearizable;
+  }
+
+  return m_foundFailure ? Result::NotLinearizable : Result::NoValidOrder;
+}
+
+template <typename Cmd>
+bool LinearizabilityChecker<Cmd>::search(const Model &state) {
+  bool done = true;
+  for (std::size_t i = 0; i < m_history.size(); i++) {
+    if (m_positions[i] < m_history[i].size()) {
+      done = false;
+      break;
+    }
+  }
+
+  if (done) {
+    return true;
+  }
+
+  if (wasExplored(state, CanMemoize())) {
+    return false;
+  }
+  m_numExplored++;
+
+  for (std::size_t i = 0; i < m_history.size(); i++) {
+    if (!canRunNext(i)) {
+      continue;
+    }
+
+    const auto &operation = m_history[i][m_positions[i]];
+    if (!isValidCommand(*operation.command, state)) {
+      continue;
+    }
+
+    try {
+      operation.verify(state);
+    } catch (const ::rc::detail::CaseResult &result) {
+      if (result.type == ::rc::detail::CaseResult::Type::Failure) {
+        m_foundFailure = true;
+        m_failure = result.description;
+        continue;
+      } else if (result.type == ::rc::detail::CaseResult::Type::Discard) {
+        continue;
+      }
+    }
+
+    auto nextState = state;
+    operation.command->apply(nextState);
+    m_positions[i]++;
+    const bool found = search(nextState);
+    m_positions[i]--;
+    if (found) {
+      return true;
+    }
+  }
+
+  markExplored(state, CanMemoize());
+  return false;
+}
+
+template <typename Cmd>
+bool LinearizabilityChecker<Cmd>::canRunNext(std::size_t thread) const {
+  if (m_positions[thread] >= m_history[thread].size()) {
+    return false;
+  }
+
+  // An operation cannot be ordered before an operation that returned before it
+  // was invoked. Since the operations of each thread ran in order, it is enough
+  // to look at the next operation of every other thread.
+  const auto &operation = m_history[thread][m_positions[thread]];
+  for (std::size_t i = 0; i < m_history.size(); i++) {
+    if ((i != thread) && (m_positions[i] < m_history[i].size()) &&
+        (m_history[i][m_positions[i]].returned < operation.invoked)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename Cmd>
+bool LinearizabilityChecker<Cmd>::wasExplored(const Model &state,
+                                              std::true_type) const {
+  const auto it = m_explored.find(m_positions);
+  return (it != end(m_explored)) &&
+      (std::find(begin(it->second), end(it->second), state) !=
+       end(it->second));
+}
+
+template <typename Cmd>
+bool LinearizabilityChecker<Cmd>::wasExplored(const Model & /*state*/,
+                                              std::false_type) const {
+  return false;
+}
+
+template <typename Cmd>
+void LinearizabilityChecker<Cmd>::markExplored(const Model &state,
+                                               std::true_type) {
+  m_explored[m_positions].push_back(state);
+}
+
+template <typename Cmd>
+void LinearizabilityChecker<Cmd>::markExplored(const Model & /*state*/,
+                                               std::false_type) {}
+
+} // namespace detail
+} // namespace state
+} // namespace rc
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "rapidcheck/detail/Traits.h"
+#include "rapidcheck/state/Command.h"
+#include "rapidcheck/state/Commands.h"
+
+namespace rc {
+namespace state {
+namespace detail {
+
+/// Keeps copies of the model state and system under test after prefixes of
+/// command sequences. Prefixes are matched by the identity of the commands.
+/// Safe to use from several threads.
+template <typename Model, typename Sut>
+class SnapshotCache {
+public:
+  using Cmd = Command<Model, Sut>;
+
+  /// Restores the snapshot for the longest prefix of `commands` into `state`
+  /// and `sut` and returns the length of that prefix. Returns `0` and leaves
+  /// `state` and `sut` untouched if there is no such snapshot.
+  std::size_t restore(const Commands<Cmd> &commands,
+                      const Model &initialState,
+                      Model &state,
+                      Sut &sut);
+
+  /// Adds a snapshot for the first `length` commands of `commands`. Drops the
+  /// least recently used snapshot if there are already `maxSnapshots`.
+  void add(const Commands<Cmd> &commands,
+           std::size_t length,
+           const Model &initialState,
+           const Model &state,
+           const Sut &sut,
+           std::size_t maxSnapshots);
+
+  /// Drops all snapshots.
+  void clear();
+
+  /// Returns the number of snapshots.
+  std::size_t size() const;
+
+private:
+  struct Snapshot {
+    Commands<Cmd> prefix;
+    Model initialState;
+    Model state;
+    Sut sut;
+    std::uint64_t lastUsed;
+  };
+
+  bool matches(const Snapshot &snapshot,
+               const Commands<Cmd> &commands,
+               const Model &initialState) const;
+
+  mutable std::mutex m_mutex;
+  std::vector<Snapshot> m_snapshots;
+  std::uint64_t m_clock = 0;
+};
+
+/// Returns the snapshots for the given model and system under test types.
+template <typename Model, typename Sut>
+SnapshotCache<Model, Sut> &snapshotCache();
+
+} // namespace detail
+} // namespace state
+} // namespace rc
+
+#include "SnapshotCache.hpp"
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+
+namespace rc {
+namespace state {
+namespace detail {
+
+template <typename Model>
+bool sameInitialState(const Model &a, const Model &b, std::true_type) {
+  return a == b;
+}
+
+template <typename Model>
+bool sameInitialState(const Model & /*a*/,
+                      const Model & /*b*/,
+                      std::false_type) {
+  return true;
+}
+
+template <typename Model, typename Sut>
+std::size_t SnapshotCache<Model, Sut>::restore(const Commands<Cmd> &commands,
+                                               const Model &initialState,
+                                               Model &state,
+                                               Sut &sut) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Snapshot *best = nullptr;
+  for (auto &snapshot : m_snapshots) {
+    if (((best == nullptr) || (snapshot.prefix.size() > best->prefix.size())) &&
+        matches(snapshot, commands, initialState)) {
+      best = &snapshot;
+    }
+  }
+
+  if (best == nullptr) {
+    return 0;
+  }
+
+  best->lastUsed = ++m_clock;
+  state = best->state;
+  sut = best->sut;
+  return best->prefix.size();
+}
+
+template <typename Model, typename Sut>
+void SnapshotCache<Model, Sut>::add(const Commands<Cmd> &commands,
+                                    std::size_t length,
+                                    const Model &initialState,
+                                    const Model &state,
+                                    const Sut &sut,
+                                    std::size_t maxSnapshots) {
+  if (maxSnapshots == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const auto &snapshot : m_snapshots) {
+    // Another thread might have run the same commands
+    if ((snapshot.prefix.size() == length) &&
+        matches(snapshot, commands, initialState)) {
+      return;
+    }
+  }
+
+  // The snapshot keeps the commands alive so their addresses cannot be reused
+  // by other commands
+  Snapshot snapshot{Commands<Cmd>(begin(commands), begin(commands) + length),
+                    initialState,
+                    state,
+                    sut,
+                    ++m_clock};
+  if (m_snapshots.size() < maxSnapshots) {
+    m_snapshots.push_back(std::move(snapshot));
+    return;
+  }
+
+  const auto leastRecentlyUsed = std::min_element(
+      begin(m_snapshots),
+      end(m_snapshots),
+      [](const Snapshot &a, const Snapshot &b) {
+        return a.lastUsed < b.lastUsed;
+      });
+  *leastRecentlyUsed = std::move(snapshot);
+}
+
+template <typename Model, typename Sut>
+void SnapshotCache<Model, Sut>::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_snapshots.clear();
+}
+
+template <typename Model, typename Sut>
+std::size_t SnapshotCache<Model, Sut>::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_snapshots.size();
+}
+
+template <typename Model, typename Sut>
+bool SnapshotCache<Model, Sut>::matches(const Snapshot &snapshot,
+                                        const Commands<Cmd> &commands,
+                                        const Model &initialState) const {
+  return (snapshot.prefix.size() <= commands.size()) &&
+      std::equal(
+          begin(snapshot.prefix), end(snapshot.prefix), begin(commands)) &&
+      sameInitialState(snapshot.initialState,
+                       initialState,
+                       ::rc::detail::IsEqualityComparable<Model>());
+}
+
+template <typename Model, typename Sut>
+SnapshotCache<Model, Sut> &snapshotCache() {
+  static SnapshotCache<Model, Sut> cache;
+  return cache;
+}
+
+} // namespace detail
+} // namespace state
+} // namespace rc
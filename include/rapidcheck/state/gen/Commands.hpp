@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
+#include <type_traits>
 
 #include "rapidcheck/Random.h"
 #include "rapidcheck/GenerationFailure.h"
@@ -105,6 +107,14 @@ private:
     }
 
   private:
+    // Model states are copied at every `kCheckpointInterval` commands so that
+    // computing the state at some index or repairing the sequence after a
+    // change does not have to replay the commands from the initial state.
+    // Copies of a sequence share the checkpoints of the prefix they have in
+    // common. Only done for copyable models.
+    static constexpr std::size_t kCheckpointInterval = 16;
+    using Checkpointed = std::is_copy_constructible<Model>;
+
     // Generates the initial sequence of commands
     void generateInitial(const Random &random, std::size_t count) {
       m_entries.reserve(count);
@@ -112,11 +122,45 @@ private:
       auto state = m_initialState();
       auto r = random;
       while (m_entries.size() < count) {
+        maybeAddCheckpoint(m_entries.size(), state);
         m_entries.push_back(nextEntry(r.split(), state));
         m_entries.back().safeApply(state);
       }
     }
 
+    // Records the given state if it is the state before the entry at the
+    // given index and a checkpoint is due there.
+    void maybeAddCheckpoint(std::size_t i, const Model &state) {
+      if (i == ((m_checkpoints.size() + 1) * kCheckpointInterval)) {
+        addCheckpoint(state, Checkpointed());
+      }
+    }
+
+    void addCheckpoint(const Model &state, std::true_type) {
+      m_checkpoints.push_back(std::make_shared<const Model>(state));
+    }
+
+    void addCheckpoint(const Model & /*state*/, std::false_type) {}
+
+    // Drops the checkpoints that are not before the given index.
+    void truncateCheckpoints(std::size_t i) {
+      m_checkpoints.resize(
+          std::min(m_checkpoints.size(), i / kCheckpointInterval));
+    }
+
+    // Returns the state before the entry at the index of the given checkpoint
+    // where `0` means the initial state.
+    Model stateAtCheckpoint(std::size_t k, std::true_type) const {
+      if (k == 0) {
+        return m_initialState();
+      }
+      return *m_checkpoints[k - 1];
+    }
+
+    Model stateAtCheckpoint(std::size_t /*k*/, std::false_type) const {
+      return m_initialState();
+    }
+
     // Tries to generate the next entry given the specified random and state.
     CommandEntry nextEntry(const Random &random, Model &state) const {
       auto r = random;
@@ -134,18 +178,23 @@ private:
 
     // Returns the state at the given index.
     Model stateAt(std::size_t n) const {
-      auto state = m_initialState();
-      for (std::size_t i = 0; i < n; i++) {
+      const auto k = std::min(n / kCheckpointInterval, m_checkpoints.size());
+      auto state = stateAtCheckpoint(k, Checkpointed());
+      for (std::size_t i = k * kCheckpointInterval; i < n; i++) {
         m_entries[i].safeApply(state);
       }
 
       return state;
     }
 
-    // Repairs entries so that the command sequence is valid.
-    void repairEntries() {
-      auto state = m_initialState();
-      for (std::size_t i = 0; i < m_entries.size(); i++) {
+    // Repairs entries so that the command sequence is valid given that the
+    // entries before the given index have not changed.
+    void repairEntriesFrom(std::size_t first) {
+      truncateCheckpoints(first);
+      const auto k = m_checkpoints.size();
+      auto state = stateAtCheckpoint(k, Checkpointed());
+      for (std::size_t i = k * kCheckpointInterval; i < m_entries.size(); i++) {
+        maybeAddCheckpoint(i, state);
         if (!repairEntryAt(i, state)) {
           m_entries.erase(begin(m_entries) + i--);
         }
@@ -207,7 +256,7 @@ private:
     // Removes the commands in the given range.
     void removeRange(std::size_t l, std::size_t r) {
       m_entries.erase(begin(m_entries) + l, begin(m_entries) + r);
-      repairEntries();
+      repairEntriesFrom(l);
     }
 
     // Returns the shrinks possible by replacing a command with shrunk version.
@@ -235,13 +284,14 @@ private:
     // Replaces the shrinkable at the given index.
     void replaceShrinkable(std::size_t i, Shrinkable<CmdSP> shrinkable) {
       m_entries[i].setShrinkable(std::move(shrinkable));
-      repairEntries();
+      repairEntriesFrom(i);
     }
 
     MakeInitialState m_initialState;
     GenFunc m_genFunc;
     int m_size;
     std::vector<CommandEntry> m_entries;
+    std::vector<std::shared_ptr<const Model>> m_checkpoints;
   };
 
   MakeInitialState m_initialState;
@@ -11,9 +11,15 @@ checkProperty(const Property &property,
               const TestMetadata &metadata,
               const TestParams &params,
               TestListener &listener,
-              const std::unordered_map<std::string, Reproduce> &reproduceMap) {
+              const std::unordered_map<std::string, Reproduce> &reproduceMap,
+              const std::string &exampleDatabase) {
   if (reproduceMap.empty()) {
-    return testProperty(property, metadata, params, listener);
+    if (exampleDatabase.empty()) {
+      return testProperty(property, metadata, params, listener);
+    }
+
+    ExampleDatabase database(exampleDatabase);
+    return testProperty(property, metadata, params, listener, database);
   }
 
   const auto it = reproduceMap.find(metadata.id);
@@ -30,12 +36,27 @@ checkProperty(const Property &property,
   }
 }
 
+TestResult
+checkProperty(const Property &property,
+              const TestMetadata &metadata,
+              const TestParams &params,
+              TestListener &listener,
+              const std::unordered_map<std::string, Reproduce> &reproduceMap) {
+  return checkProperty(
+      property, metadata, params, listener, reproduceMap, std::string());
+}
+
 TestResult checkProperty(const Property &property,
                          const TestMetadata &metadata,
                          const TestParams &params,
                          TestListener &listener) {
-  return checkProperty(
-      property, metadata, params, listener, configuration().reproduce);
+  const auto &config = configuration();
+  return checkProperty(property,
+                       metadata,
+                       params,
+                       listener,
+                       config.reproduce,
+                       config.exampleDatabase);
 }
 
 TestResult checkProperty(const Property &property,
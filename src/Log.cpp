@@ -1,5 +1,7 @@
 #include "rapidcheck/Log.h"
 
+#include <cstring>
+
 #include "rapidcheck/detail/ImplicitParam.h"
 #include "rapidcheck/detail/PropertyContext.h"
 
@@ -10,9 +12,19 @@ std::ostream &log() {
   return ImplicitParam<param::CurrentPropertyContext>::value()->logStream();
 }
 
-void log(const std::string &msg) {
-  log() << msg << std::endl;
+namespace {
+
+void logLine(const char *data, std::size_t size) {
+  const auto context = ImplicitParam<param::CurrentPropertyContext>::value();
+  context->appendLog(data, size);
+  context->appendLog("\n", 1);
 }
 
+} // namespace
+
+void log(const std::string &msg) { logLine(msg.data(), msg.size()); }
+
+void log(const char *msg) { logLine(msg, std::strlen(msg)); }
+
 } // namespace detail
 } // namespace rc
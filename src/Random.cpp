@@ -1,5 +1,7 @@
 #include "rapidcheck/Random.h"
 
+#include <algorithm>
+#include <bitset>
 #include <iostream>
 #include <cassert>
 #include <functional>
@@ -14,8 +16,29 @@ namespace {
 
 constexpr uint64_t kKeyScheduleParity = 0x1BD11BDAA9FC1A22ULL;
 constexpr uint64_t kTweak[2] = {13, 37};
+
+// SplitMix64 constants and mixing functions, see Steele et al.
+constexpr uint64_t kGoldenGamma = 0x9E3779B97F4A7C15ULL;
+
+uint64_t mix64(uint64_t z) {
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
 }
 
+uint64_t mixGamma(uint64_t z) {
+  z = (z ^ (z >> 33)) * 0xFF51AFD7ED558CCDULL;
+  z = (z ^ (z >> 33)) * 0xC4CEB9FE1A85EC53ULL;
+  z = (z ^ (z >> 33)) | 1;
+  // Gammas with too few bit transitions yield poor sequences
+  if (std::bitset<64>(z ^ (z >> 1)).count() < 24) {
+    z ^= 0xAAAAAAAAAAAAAAAAULL;
+  }
+  return z;
+}
+
+} // namespace
+
 Random::Random()
     : Random(Key{{0, 0, 0, 0}}) {}
 
@@ -24,13 +47,31 @@ Random::Random(const Key &key)
     , m_block()
     , m_bits(0)
     , m_counter(0)
-    , m_bitsi(0) {}
+    , m_bitsi(0)
+    , m_engine(Engine::Default) {}
 
 // We just repeat the seed in the key
 Random::Random(uint64_t seed)
     : Random(Key{{seed, seed, seed, seed}}) {}
 
+Random::Random(uint64_t seed, Engine engine)
+    : Random(seed) {
+  if (engine == Engine::Fast) {
+    m_key = Key{{seed, kGoldenGamma, 0, 0}};
+    m_engine = engine;
+  }
+}
+
+Random::Engine Random::engine() const { return m_engine; }
+
 Random Random::split() {
+  if (m_engine == Engine::Fast) {
+    Random right(*this);
+    right.m_key[0] = mix64(nextFastSeed());
+    right.m_key[1] = mixGamma(nextFastSeed());
+    return right;
+  }
+
   assert(m_counter == 0);
   Random right(*this);
   append(false);
@@ -39,6 +80,10 @@ Random Random::split() {
 }
 
 Random::Number Random::next() {
+  if (m_engine == Engine::Fast) {
+    return mix64(nextFastSeed());
+  }
+
   std::size_t blki = m_counter % std::tuple_size<Block>::value;
   if (blki == 0) {
     mash(m_block);
@@ -54,6 +99,42 @@ Random::Number Random::next() {
   return m_block[blki];
 }
 
+void Random::fill(Number *output, std::size_t n) {
+  constexpr auto kBlockSize = std::tuple_size<Block>::value;
+  if (m_engine == Engine::Fast) {
+    for (std::size_t i = 0; i < n; i++) {
+      output[i] = mix64(nextFastSeed());
+    }
+    return;
+  }
+
+  // Finish the current block first, if any
+  while ((n > 0) && ((m_counter % kBlockSize) != 0)) {
+    *output++ = next();
+    n--;
+  }
+
+  // Then whole blocks can be generated without checking the position in the
+  // block for every number. The counter must not wrap within a block.
+  while ((n >= kBlockSize) && (m_counter <= (kCounterMax - kBlockSize))) {
+    mash(m_block);
+    std::copy(begin(m_block), end(m_block), output);
+    m_counter += kBlockSize;
+    output += kBlockSize;
+    n -= kBlockSize;
+  }
+
+  while (n > 0) {
+    *output++ = next();
+    n--;
+  }
+}
+
+uint64_t Random::nextFastSeed() {
+  m_key[0] += m_key[1];
+  return m_key[0];
+}
+
 void Random::append(bool x) {
   if (m_bitsi == kBits) {
     mash(m_key);
@@ -427,15 +508,23 @@ void Random::mash(Block &output) {
 bool operator==(const Random &lhs, const Random &rhs) {
   return (lhs.m_key == rhs.m_key) && (lhs.m_block == rhs.m_block) &&
       (lhs.m_bits == rhs.m_bits) && (lhs.m_counter == rhs.m_counter) &&
-      (lhs.m_bitsi == rhs.m_bitsi);
+      (lhs.m_bitsi == rhs.m_bitsi) && (lhs.m_engine == rhs.m_engine);
 }
 
 bool operator!=(const Random &lhs, const Random &rhs) { return !(lhs == rhs); }
 
 bool operator<(const Random &lhs, const Random &rhs) {
-  return std::tie(
-             lhs.m_key, lhs.m_block, lhs.m_bits, lhs.m_counter, lhs.m_bitsi) <
-      std::tie(rhs.m_key, rhs.m_block, rhs.m_bits, rhs.m_counter, rhs.m_bitsi);
+  return std::tie(lhs.m_key,
+                  lhs.m_block,
+                  lhs.m_bits,
+                  lhs.m_counter,
+                  lhs.m_bitsi,
+                  lhs.m_engine) < std::tie(rhs.m_key,
+                                           rhs.m_block,
+                                           rhs.m_bits,
+                                           rhs.m_counter,
+                                           rhs.m_bitsi,
+                                           rhs.m_engine);
 }
 
 std::ostream &operator<<(std::ostream &os, const Random &random) {
@@ -446,6 +535,9 @@ std::ostream &operator<<(std::ostream &os, const Random &random) {
   os << ", bits=" << random.m_bits;
   os << ", counter=" << random.m_counter;
   os << ", bitsi=" << static_cast<int>(random.m_bitsi);
+  if (random.m_engine == Random::Engine::Fast) {
+    os << ", engine=fast";
+  }
   return os;
 }
 
@@ -3,9 +3,45 @@
 namespace rc {
 namespace detail {
 
-Any::Any() noexcept {}
+Any::Any() noexcept
+    : m_impl(nullptr)
+    , m_inline(false) {}
 
-void Any::reset() { m_impl.reset(); }
+Any::Any(Any &&other) noexcept
+    : m_impl(nullptr)
+    , m_inline(false) {
+  moveFrom(other);
+}
+
+Any &Any::operator=(Any &&rhs) noexcept {
+  if (this != &rhs) {
+    reset();
+    moveFrom(rhs);
+  }
+  return *this;
+}
+
+Any::~Any() noexcept { reset(); }
+
+void Any::reset() {
+  if (m_inline) {
+    m_impl->~IAnyImpl();
+  } else {
+    delete m_impl;
+  }
+  m_impl = nullptr;
+  m_inline = false;
+}
+
+void Any::moveFrom(Any &other) noexcept {
+  if (other.m_inline) {
+    other.m_impl->moveTo(*this);
+    other.reset();
+  } else {
+    m_impl = other.m_impl;
+    other.m_impl = nullptr;
+  }
+}
 
 
 void Any::showType(std::ostream &os) const {
@@ -20,7 +56,17 @@ void Any::showValue(std::ostream &os) const {
   }
 }
 
-Any::operator bool() const { return static_cast<bool>(m_impl); }
+bool Any::hashValue(std::size_t &hash) const {
+  return m_impl && m_impl->hashValue(hash);
+}
+
+bool Any::equalValue(const Any &other) const {
+  return m_impl && other.m_impl &&
+      (m_impl->typeKey() == other.m_impl->typeKey()) &&
+      m_impl->equalValue(*other.m_impl);
+}
+
+Any::operator bool() const { return m_impl != nullptr; }
 
 std::ostream &operator<<(std::ostream &os, const Any &value) {
   value.showValue(os);
@@ -1,5 +1,8 @@
 #include "rapidcheck/Assertions.h"
 
+#include "rapidcheck/detail/ImplicitParam.h"
+#include "rapidcheck/detail/PropertyContext.h"
+
 namespace rc {
 namespace detail {
 
@@ -41,5 +44,12 @@ std::string makeWrongExceptionMessage(const std::string &file,
                      "Thrown exception did not match " + expected + ".");
 }
 
+void reportResult(const CaseResult &result) {
+  if (!ImplicitParam<param::CurrentPropertyContext>::value()->reportResult(
+          result)) {
+    throw result;
+  }
+}
+
 } // namespace detail
 } // namespace rc
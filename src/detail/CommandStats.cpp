@@ -0,0 +1,104 @@
+#include "rapidcheck/detail/CommandStats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+#include "rapidcheck/detail/Platform.h"
+
+namespace rc {
+namespace detail {
+namespace {
+
+std::atomic<CommandStatsRecorder *> gCurrentRecorder(nullptr);
+
+std::string formatDuration(double nanos) {
+  static const char *const units[] = {"ns", "us", "ms", "s"};
+  std::size_t unit = 0;
+  while ((nanos >= 1000.0) && (unit < 3)) {
+    nanos /= 1000.0;
+    unit++;
+  }
+
+  std::ostringstream ss;
+  ss << std::fixed << std::setprecision((unit == 0) ? 0 : 1) << nanos
+     << units[unit];
+  return ss.str();
+}
+
+} // namespace
+
+CommandStatsRecorder *CommandStatsRecorder::current() noexcept {
+  return gCurrentRecorder.load(std::memory_order_acquire);
+}
+
+#ifndef RC_DONT_USE_RTTI
+void CommandStatsRecorder::record(const std::type_info &type,
+                                  std::uint64_t nanos) {
+  // Demangling is expensive so it is deferred until the stats are requested
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_byType[std::type_index(type)].record(nanos);
+}
+#endif // RC_DONT_USE_RTTI
+
+void CommandStatsRecorder::record(const std::string &name,
+                                  std::uint64_t nanos) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_byName[name].record(nanos);
+}
+
+std::vector<CommandStats> CommandStatsRecorder::stats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto byName = m_byName;
+#ifndef RC_DONT_USE_RTTI
+  for (const auto &entry : m_byType) {
+    byName[demangle(entry.first.name())].merge(entry.second);
+  }
+#endif // RC_DONT_USE_RTTI
+
+  std::vector<CommandStats> stats;
+  stats.reserve(byName.size());
+  for (auto &entry : byName) {
+    CommandStats commandStats;
+    commandStats.name = entry.first;
+    commandStats.latencies = std::move(entry.second);
+    stats.push_back(std::move(commandStats));
+  }
+  return stats;
+}
+
+CommandStatsScope::CommandStatsScope(CommandStatsRecorder *recorder)
+    : m_previous(gCurrentRecorder.exchange(recorder)) {}
+
+CommandStatsScope::~CommandStatsScope() { gCurrentRecorder = m_previous; }
+
+void printCommandStats(const std::vector<CommandStats> &stats,
+                       std::ostream &os) {
+  std::size_t nameWidth = 7;
+  for (const auto &commandStats : stats) {
+    nameWidth = std::max(nameWidth, commandStats.name.size());
+  }
+
+  os << std::left << std::setw(static_cast<int>(nameWidth)) << "Command"
+     << std::right << std::setw(10) << "count" << std::setw(10) << "mean"
+     << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10)
+     << "p99" << std::setw(10) << "max" << std::endl;
+  for (const auto &commandStats : stats) {
+    const auto &latencies = commandStats.latencies;
+    os << std::left << std::setw(static_cast<int>(nameWidth))
+       << commandStats.name << std::right << std::setw(10) << latencies.count()
+       << std::setw(10) << formatDuration(latencies.mean()) << std::setw(10)
+       << formatDuration(static_cast<double>(latencies.percentile(50)))
+       << std::setw(10)
+       << formatDuration(static_cast<double>(latencies.percentile(90)))
+       << std::setw(10)
+       << formatDuration(static_cast<double>(latencies.percentile(99)))
+       << std::setw(10)
+       << formatDuration(static_cast<double>(latencies.max())) << std::endl;
+  }
+}
+
+} // namespace detail
+} // namespace rc
@@ -28,7 +28,8 @@ bool operator==(const Configuration &c1, const Configuration &c2) {
   return (c1.testParams == c2.testParams) &&
       (c1.verboseProgress == c2.verboseProgress) &&
       (c1.verboseShrinking == c2.verboseShrinking) &&
-      (c1.reproduce == c2.reproduce);
+      (c1.reproduce == c2.reproduce) &&
+      (c1.exampleDatabase == c2.exampleDatabase);
 }
 
 bool operator!=(const Configuration &c1, const Configuration &c2) {
@@ -51,6 +52,24 @@ void fromString(const std::string &str, T &out, bool &ok) {
   ok = !in.fail();
 }
 
+template <typename T>
+void fromString(const std::string &str, std::string &out, bool &ok) {
+  out = str;
+  ok = true;
+}
+
+template <typename T>
+void fromString(const std::string &str, Random::Engine &out, bool &ok) {
+  ok = true;
+  if (str == "default") {
+    out = Random::Engine::Default;
+  } else if (str == "fast") {
+    out = Random::Engine::Fast;
+  } else {
+    ok = false;
+  }
+}
+
 template <typename T>
 void fromString(const std::string &str,
                 std::unordered_map<std::string, Reproduce> &out,
@@ -90,6 +109,11 @@ bool isNonNegative(T x) {
   return x >= 0;
 }
 
+template <typename T>
+bool isPositive(T x) {
+  return x > 0;
+}
+
 template <typename T>
 bool anything(const T &) {
   return true;
@@ -105,6 +129,12 @@ Configuration configFromMap(const std::map<std::string, std::string> &map,
             "'seed' must be a valid integer",
             anything<uint64_t>);
 
+  loadParam(map,
+            "engine",
+            config.testParams.engine,
+            "'engine' must be either 'default' or 'fast'",
+            anything<Random::Engine>);
+
   loadParam(map,
             "max_success",
             config.testParams.maxSuccess,
@@ -123,12 +153,60 @@ Configuration configFromMap(const std::map<std::string, std::string> &map,
             "'max_discard_ratio' must be a valid non-negative integer",
             isNonNegative<int>);
 
+  loadParam(map,
+            "max_time",
+            config.testParams.maxTime,
+            "'max_time' must be a valid non-negative integer",
+            isNonNegative<int>);
+
+  loadParam(map,
+            "max_shrink_time",
+            config.testParams.maxShrinkTime,
+            "'max_shrink_time' must be a valid non-negative integer",
+            isNonNegative<int>);
+
+  loadParam(map,
+            "max_shrink_steps",
+            config.testParams.maxShrinkSteps,
+            "'max_shrink_steps' must be a valid non-negative integer",
+            isNonNegative<int>);
+
   loadParam(map,
             "noshrink",
             config.testParams.disableShrinking,
             "'noshrink' must be either '1' or '0'",
             anything<bool>);
 
+  loadParam(map,
+            "threads",
+            config.testParams.numThreads,
+            "'threads' must be a valid positive integer",
+            isPositive<int>);
+
+  loadParam(map,
+            "shrink_threads",
+            config.testParams.numShrinkThreads,
+            "'shrink_threads' must be a valid positive integer",
+            isPositive<int>);
+
+  loadParam(map,
+            "shrink_cache",
+            config.testParams.cacheShrinks,
+            "'shrink_cache' must be either '1' or '0'",
+            anything<bool>);
+
+  loadParam(map,
+            "pool_allocation",
+            config.testParams.poolAllocation,
+            "'pool_allocation' must be either '1' or '0'",
+            anything<bool>);
+
+  loadParam(map,
+            "command_stats",
+            config.testParams.commandStats,
+            "'command_stats' must be either '1' or '0'",
+            anything<bool>);
+
   loadParam(map,
             "verbose_progress",
             config.verboseProgress,
@@ -147,19 +225,44 @@ Configuration configFromMap(const std::map<std::string, std::string> &map,
             "'reproduce' string has invalid format",
             anything<decltype(config.reproduce)>);
 
+  loadParam(map,
+            "example_db",
+            config.exampleDatabase,
+            "'example_db' must be a valid path",
+            anything<std::string>);
+
+  loadParam(map,
+            "ddmin_threshold",
+            config.testParams.ddminThreshold,
+            "'ddmin_threshold' must be a valid non-negative integer",
+            isNonNegative<int>);
+
   return config;
 }
 
 std::map<std::string, std::string> mapFromConfig(const Configuration &config) {
   return {
       {"seed", std::to_string(config.testParams.seed)},
+      {"engine",
+       (config.testParams.engine == Random::Engine::Fast) ? "fast"
+                                                          : "default"},
       {"max_success", std::to_string(config.testParams.maxSuccess)},
       {"max_size", std::to_string(config.testParams.maxSize)},
       {"max_discard_ratio", std::to_string(config.testParams.maxDiscardRatio)},
+      {"max_time", std::to_string(config.testParams.maxTime)},
+      {"max_shrink_time", std::to_string(config.testParams.maxShrinkTime)},
+      {"max_shrink_steps", std::to_string(config.testParams.maxShrinkSteps)},
       {"noshrink", config.testParams.disableShrinking ? "1" : "0"},
+      {"threads", std::to_string(config.testParams.numThreads)},
+      {"shrink_threads", std::to_string(config.testParams.numShrinkThreads)},
+      {"shrink_cache", config.testParams.cacheShrinks ? "1" : "0"},
+      {"pool_allocation", config.testParams.poolAllocation ? "1" : "0"},
+      {"command_stats", config.testParams.commandStats ? "1" : "0"},
+      {"ddmin_threshold", std::to_string(config.testParams.ddminThreshold)},
       {"verbose_progress", std::to_string(config.verboseProgress)},
       {"verbose_shrinking", std::to_string(config.verboseShrinking)},
-      {"reproduce", reproduceMapToString(config.reproduce)}};
+      {"reproduce", reproduceMapToString(config.reproduce)},
+      {"example_db", config.exampleDatabase}};
 }
 
 std::map<std::string, std::string>
@@ -0,0 +1,49 @@
+#include "DistributionCounter.h"
+
+namespace rc {
+namespace detail {
+
+void DistributionCounter::add(const Tags &tags) {
+  m_key.clear();
+  for (const auto &tag : tags) {
+    auto it = m_ids.find(tag);
+    if (it == end(m_ids)) {
+      it = m_ids.emplace(tag, m_strings.size()).first;
+      m_strings.push_back(&it->first);
+    }
+    m_key.push_back(it->second);
+  }
+
+  const auto it = m_counts.find(m_key);
+  if (it != end(m_counts)) {
+    it->second++;
+  } else {
+    m_counts.emplace(m_key, 1);
+  }
+}
+
+bool DistributionCounter::empty() const { return m_counts.empty(); }
+
+Distribution DistributionCounter::distribution() const {
+  Distribution distribution;
+  for (const auto &entry : m_counts) {
+    Tags tags;
+    tags.reserve(entry.first.size());
+    for (const auto id : entry.first) {
+      tags.push_back(*m_strings[id]);
+    }
+    distribution[std::move(tags)] += entry.second;
+  }
+  return distribution;
+}
+
+std::size_t DistributionCounter::KeyHash::operator()(const Key &key) const {
+  std::size_t hash = key.size();
+  for (const auto id : key) {
+    hash ^= id + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+} // namespace detail
+} // namespace rc
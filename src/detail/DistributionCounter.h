@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "rapidcheck/detail/Results.h"
+
+namespace rc {
+namespace detail {
+
+/// Counts how many times each combination of tags occurs as test cases finish.
+/// Tag strings are interned and combinations are stored as lists of indices so
+/// memory use depends on the number of distinct tags and combinations, not on
+/// the number of test cases.
+class DistributionCounter {
+public:
+  /// Counts one occurrence of the given tags.
+  void add(const Tags &tags);
+
+  /// Returns whether nothing has been counted.
+  bool empty() const;
+
+  /// Returns the counts as a `Distribution`.
+  Distribution distribution() const;
+
+private:
+  using Key = std::vector<std::size_t>;
+
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const;
+  };
+
+  std::unordered_map<std::string, std::size_t> m_ids;
+  std::vector<const std::string *> m_strings;
+  std::unordered_map<Key, int, KeyHash> m_counts;
+  // Reused between calls to `add` to avoid allocating a new key every time
+  Key m_key;
+};
+
+} // namespace detail
+} // namespace rc
@@ -0,0 +1,93 @@
+#include "rapidcheck/detail/EvaluationCache.h"
+
+namespace rc {
+namespace detail {
+namespace {
+
+bool tryMakeKey(const gen::detail::Recipe &recipe, EvaluationCache::Key &key) {
+  key.random = recipe.random;
+  key.size = recipe.size;
+  key.values.reserve(recipe.numIngredients());
+  key.hash = std::hash<int>()(recipe.size);
+  for (std::size_t i = 0; i < recipe.numIngredients(); i++) {
+    try {
+      key.values.push_back(recipe.ingredient(i)->value());
+    } catch (...) {
+      return false;
+    }
+
+    std::size_t hash;
+    if (!key.values.back().hashValue(hash)) {
+      return false;
+    }
+    key.hash = combineHash(key.hash, hash);
+  }
+
+  return true;
+}
+
+} // namespace
+
+bool EvaluationCache::KeyEqual::operator()(const Key &lhs,
+                                           const Key &rhs) const {
+  if ((lhs.size != rhs.size) || (lhs.random != rhs.random) ||
+      (lhs.values.size() != rhs.values.size())) {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < lhs.values.size(); i++) {
+    if (!lhs.values[i].equalValue(rhs.values[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+EvaluationCache::EvaluationCache()
+    : m_numHits(0)
+    , m_numMisses(0) {}
+
+Maybe<TaggedResult> EvaluationCache::lookup(const gen::detail::Recipe &recipe,
+                                            Key &key) {
+  key.cacheable = tryMakeKey(recipe, key);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (key.cacheable) {
+    const auto it = m_results.find(key);
+    if (it != end(m_results)) {
+      m_numHits++;
+      return it->second;
+    }
+  }
+
+  m_numMisses++;
+  return Nothing;
+}
+
+void EvaluationCache::insert(Key key, const TaggedResult &result) {
+  if (!key.cacheable || (result.result.type == CaseResult::Type::Failure)) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_results.emplace(std::move(key), result);
+}
+
+int EvaluationCache::numHits() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_numHits;
+}
+
+int EvaluationCache::numMisses() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_numMisses;
+}
+
+namespace param {
+
+EvaluationCache *CurrentEvaluationCache::defaultValue() { return nullptr; }
+
+} // namespace param
+} // namespace detail
+} // namespace rc
@@ -0,0 +1,90 @@
+#include "ExampleDatabase.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+#include "Base64.h"
+#include "ParseException.h"
+#include "StringSerialization.h"
+#include "rapidcheck/detail/Platform.h"
+
+namespace rc {
+namespace detail {
+namespace {
+
+// File names have a limited length so long IDs are truncated and a hash of the
+// entire ID is appended instead. This is FNV-1a since it needs to be stable
+// across runs, platforms and standard libraries.
+constexpr std::size_t kMaxEncodedIdLength = 96;
+
+uint64_t hashId(const std::string &id) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (const auto c : id) {
+    hash ^= static_cast<std::uint8_t>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+} // namespace
+
+ExampleDatabase::ExampleDatabase(std::string directory)
+    : m_directory(std::move(directory)) {}
+
+std::vector<Reproduce> ExampleDatabase::load(const std::string &id) const {
+  std::vector<Reproduce> entries;
+  std::ifstream in(pathFor(id));
+  std::string line;
+  while (std::getline(in, line)) {
+    try {
+      entries.push_back(stringToReproduce(line));
+    } catch (const ParseException &) {
+      // Probably written by an incompatible version, ignore it
+    }
+  }
+
+  return entries;
+}
+
+void ExampleDatabase::store(const std::string &id,
+                            const std::vector<Reproduce> &entries) {
+  const auto path = pathFor(id);
+  if (entries.empty()) {
+    std::remove(path.c_str());
+    return;
+  }
+
+  makeDirectory(m_directory);
+  std::ofstream out(path, std::ios::trunc);
+  for (const auto &entry : entries) {
+    out << reproduceToString(entry) << std::endl;
+  }
+}
+
+void ExampleDatabase::add(const std::string &id, const Reproduce &reproduce) {
+  auto entries = load(id);
+  if (std::find(begin(entries), end(entries), reproduce) == end(entries)) {
+    entries.push_back(reproduce);
+    store(id, entries);
+  }
+}
+
+std::string ExampleDatabase::pathFor(const std::string &id) const {
+  // The prefix keeps the name non-empty even for an empty ID
+  auto name =
+      "id_" + base64Encode(std::vector<std::uint8_t>(begin(id), end(id)));
+  if (name.size() > kMaxEncodedIdLength) {
+    std::ostringstream os;
+    os << name.substr(0, kMaxEncodedIdLength) << '-' << std::hex
+       << std::setfill('0') << std::setw(16) << hashId(id);
+    name = os.str();
+  }
+
+  return m_directory + "/" + name;
+}
+
+} // namespace detail
+} // namespace rc
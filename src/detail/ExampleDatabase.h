@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "rapidcheck/detail/Results.h"
+
+namespace rc {
+namespace detail {
+
+/// An on-disk database of failing test cases. The database is a directory
+/// which contains one file per test, named after the ID of the test. Each file
+/// contains one encoded `Reproduce` value per line.
+class ExampleDatabase {
+public:
+  /// Constructs a database for the given directory. The directory is created
+  /// when something is first stored in it.
+  explicit ExampleDatabase(std::string directory);
+
+  /// Returns the entries stored for the test with the given ID. Entries that
+  /// cannot be parsed are ignored.
+  std::vector<Reproduce> load(const std::string &id) const;
+
+  /// Replaces the entries stored for the test with the given ID. If `entries`
+  /// is empty, the file for the test is removed.
+  void store(const std::string &id, const std::vector<Reproduce> &entries);
+
+  /// Adds an entry for the test with the given ID unless an identical entry is
+  /// already stored.
+  void add(const std::string &id, const Reproduce &reproduce);
+
+  /// Returns the path of the file used for the test with the given ID.
+  std::string pathFor(const std::string &id) const;
+
+private:
+  std::string m_directory;
+};
+
+} // namespace detail
+} // namespace rc
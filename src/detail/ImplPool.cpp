@@ -0,0 +1,123 @@
+#include "rapidcheck/detail/ImplPool.h"
+
+namespace rc {
+namespace detail {
+namespace {
+
+// Every implementation object has a vtable so their sizes are multiples of
+// the pointer alignment. Blocks are only ever reused for objects of exactly the
+// same size which means that memory from the global allocator does not need to
+// be rounded up to be pooled later.
+constexpr std::size_t kGranularity = alignof(void *);
+constexpr std::size_t kNumSizeClasses = 256 / kGranularity;
+// Keeps a thread that releases a huge tree from hoarding all of that memory
+constexpr std::size_t kMaxFreeBlocks = 4096;
+
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+// This is deliberately trivially destructible so that it can still be used
+// when objects are released by the destructors of other thread locals or
+// statics after `ThreadPoolCleaner` has run.
+struct ThreadPool {
+  bool enabled;
+  bool finished;
+  std::size_t numAllocations;
+  FreeBlock *freeBlocks[kNumSizeClasses];
+  std::size_t numFreeBlocks[kNumSizeClasses];
+};
+
+thread_local ThreadPool tPool;
+
+struct ThreadPoolCleaner {
+  ~ThreadPoolCleaner() {
+    tPool.finished = true;
+    for (std::size_t i = 0; i < kNumSizeClasses; i++) {
+      while (tPool.freeBlocks[i]) {
+        const auto block = tPool.freeBlocks[i];
+        tPool.freeBlocks[i] = block->next;
+        ::operator delete(block);
+      }
+      tPool.numFreeBlocks[i] = 0;
+    }
+  }
+};
+
+thread_local ThreadPoolCleaner tPoolCleaner;
+
+/// Returns the size class for the given size or `kNumSizeClasses` if memory of
+/// that size is not pooled.
+std::size_t sizeClassOf(std::size_t size) {
+  if ((size == 0) || ((size % kGranularity) != 0)) {
+    return kNumSizeClasses;
+  }
+
+  const auto sizeClass = size / kGranularity - 1;
+  return (sizeClass < kNumSizeClasses) ? sizeClass : kNumSizeClasses;
+}
+
+} // namespace
+
+std::atomic<int> ImplPool::m_numEnabledScopes(0);
+
+void *ImplPool::allocatePooled(std::size_t size) {
+  if (!tPool.enabled) {
+    return ::operator new(size);
+  }
+
+  const auto sizeClass = sizeClassOf(size);
+  if (sizeClass != kNumSizeClasses) {
+    auto &freeBlock = tPool.freeBlocks[sizeClass];
+    if (freeBlock) {
+      const auto block = freeBlock;
+      freeBlock = block->next;
+      tPool.numFreeBlocks[sizeClass]--;
+      return block;
+    }
+  }
+
+  tPool.numAllocations++;
+  return ::operator new(size);
+}
+
+void ImplPool::deallocatePooled(void *p, std::size_t size) noexcept {
+  const auto sizeClass = sizeClassOf(size);
+  if (!tPool.enabled || tPool.finished || (sizeClass == kNumSizeClasses) ||
+      (tPool.numFreeBlocks[sizeClass] >= kMaxFreeBlocks)) {
+    ::operator delete(p);
+    return;
+  }
+
+  // Makes sure that the cleaner is constructed on this thread
+  static_cast<void>(&tPoolCleaner);
+  const auto block = static_cast<FreeBlock *>(p);
+  block->next = tPool.freeBlocks[sizeClass];
+  tPool.freeBlocks[sizeClass] = block;
+  tPool.numFreeBlocks[sizeClass]++;
+}
+
+bool ImplPool::isEnabled() noexcept { return tPool.enabled; }
+
+std::size_t ImplPool::numAllocations() noexcept {
+  return tPool.numAllocations;
+}
+
+ImplPoolScope::ImplPoolScope(bool enabled)
+    : m_enabled(enabled)
+    , m_wasEnabled(tPool.enabled) {
+  tPool.enabled = enabled;
+  if (m_enabled) {
+    ImplPool::m_numEnabledScopes.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+ImplPoolScope::~ImplPoolScope() {
+  if (m_enabled) {
+    ImplPool::m_numEnabledScopes.fetch_sub(1, std::memory_order_relaxed);
+  }
+  tPool.enabled = m_wasEnabled;
+}
+
+} // namespace detail
+} // namespace rc
@@ -3,16 +3,25 @@
 namespace rc {
 namespace detail {
 
-ImplicitScope::ImplicitScope() { m_scopes.emplace(); }
+ImplicitScope::ImplicitScope() {
+  auto &scopes = m_scopes;
+  if (scopes.depth == scopes.scopes.size()) {
+    scopes.scopes.emplace_back();
+  }
+  scopes.depth++;
+}
 
 ImplicitScope::~ImplicitScope() {
-  for (auto destructor : m_scopes.top()) {
+  auto &scopes = m_scopes;
+  auto &destructors = scopes.scopes[scopes.depth - 1];
+  for (auto destructor : destructors) {
     destructor();
   }
-  m_scopes.pop();
+  destructors.clear();
+  scopes.depth--;
 }
 
-ImplicitScope::ScopeStack ImplicitScope::m_scopes;
+thread_local ImplicitScope::ScopeStack ImplicitScope::m_scopes;
 
 } // namespace detail
 } // namespace rc
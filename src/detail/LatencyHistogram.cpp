@@ -0,0 +1,101 @@
+#include "rapidcheck/detail/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rc {
+namespace detail {
+namespace {
+
+constexpr int kSubBucketBits = 5;
+constexpr std::uint64_t kNumSubBuckets = 1ULL << kSubBucketBits;
+
+int highestBit(std::uint64_t value) {
+  int bit = 0;
+  while ((value >>= 1) != 0) {
+    bit++;
+  }
+  return bit;
+}
+
+std::size_t bucketIndex(std::uint64_t value) {
+  if (value < kNumSubBuckets) {
+    return static_cast<std::size_t>(value);
+  }
+
+  const auto shift = highestBit(value) - kSubBucketBits;
+  const auto subBucket = (value >> shift) - kNumSubBuckets;
+  return static_cast<std::size_t>((shift + 1) * kNumSubBuckets + subBucket);
+}
+
+std::uint64_t bucketUpperBound(std::size_t index) {
+  if (index < kNumSubBuckets) {
+    return index;
+  }
+
+  const auto shift = static_cast<int>(index / kNumSubBuckets) - 1;
+  const auto subBucket = index % kNumSubBuckets;
+  const auto lower = (kNumSubBuckets + subBucket) << shift;
+  return lower + ((1ULL << shift) - 1);
+}
+
+} // namespace
+
+void LatencyHistogram::record(std::uint64_t value) {
+  const auto index = bucketIndex(value);
+  if (index >= m_counts.size()) {
+    m_counts.resize(index + 1, 0);
+  }
+  m_counts[index]++;
+
+  m_min = (m_count == 0) ? value : std::min(m_min, value);
+  m_max = std::max(m_max, value);
+  m_sum += static_cast<double>(value);
+  m_count++;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+  if (other.m_count == 0) {
+    return;
+  }
+
+  if (other.m_counts.size() > m_counts.size()) {
+    m_counts.resize(other.m_counts.size(), 0);
+  }
+  for (std::size_t i = 0; i < other.m_counts.size(); i++) {
+    m_counts[i] += other.m_counts[i];
+  }
+
+  m_min = (m_count == 0) ? other.m_min : std::min(m_min, other.m_min);
+  m_max = std::max(m_max, other.m_max);
+  m_sum += other.m_sum;
+  m_count += other.m_count;
+}
+
+double LatencyHistogram::mean() const {
+  return (m_count == 0) ? 0.0 : (m_sum / static_cast<double>(m_count));
+}
+
+std::uint64_t LatencyHistogram::percentile(double percent) const {
+  if (m_count == 0) {
+    return 0;
+  }
+
+  const auto clamped = std::min(std::max(percent, 0.0), 100.0);
+  const auto target = std::max<std::uint64_t>(
+      static_cast<std::uint64_t>(
+          std::ceil((clamped / 100.0) * static_cast<double>(m_count))),
+      1);
+  std::uint64_t seen = 0;
+  for (std::size_t i = 0; i < m_counts.size(); i++) {
+    seen += m_counts[i];
+    if (seen >= target) {
+      return std::min(bucketUpperBound(i), m_max);
+    }
+  }
+
+  return m_max;
+}
+
+} // namespace detail
+} // namespace rc
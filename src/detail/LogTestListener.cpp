@@ -44,6 +44,28 @@ void LogTestListener::onShrinkTried(const CaseDescription &/*shrink*/,
   }
 }
 
+void LogTestListener::onShrinkCacheStats(int numHits, int numMisses) {
+  if (!m_verboseShrinking) {
+    return;
+  }
+
+  m_out << std::endl
+        << "Shrink cache: " << numHits << " hits, " << numMisses << " misses";
+}
+
+void LogTestListener::onCommandStats(const std::vector<CommandStats> &stats) {
+  // Command stats are opt-in so they are printed regardless of verbosity
+  if (stats.empty()) {
+    return;
+  }
+
+  if (m_verboseProgress || m_verboseShrinking) {
+    m_out << std::endl;
+  }
+  m_out << "Command stats:" << std::endl;
+  printCommandStats(stats, m_out);
+}
+
 void LogTestListener::onTestFinished(const TestMetadata &/*metadata*/,
                                      const TestResult &/*result*/) {
   if (m_verboseShrinking || m_verboseProgress) {
@@ -15,6 +15,8 @@ public:
                            bool verboseShrinking = false);
   void onTestCaseFinished(const CaseDescription &description) override;
   void onShrinkTried(const CaseDescription &shrink, bool accepted) override;
+  void onShrinkCacheStats(int numHits, int numMisses) override;
+  void onCommandStats(const std::vector<CommandStats> &stats) override;
   void onTestFinished(const TestMetadata &metadata,
                       const TestResult &result) override;
 
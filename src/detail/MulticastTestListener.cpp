@@ -20,6 +20,19 @@ void MulticastTestListener::onShrinkTried(const CaseDescription &shrink,
   }
 }
 
+void MulticastTestListener::onShrinkCacheStats(int numHits, int numMisses) {
+  for (auto &listener : m_listeners) {
+    listener->onShrinkCacheStats(numHits, numMisses);
+  }
+}
+
+void MulticastTestListener::onCommandStats(
+    const std::vector<CommandStats> &stats) {
+  for (const auto &listener : m_listeners) {
+    listener->onCommandStats(stats);
+  }
+}
+
 void MulticastTestListener::onTestFinished(const TestMetadata &metadata,
                                            const TestResult &result) {
   for (auto &listener : m_listeners) {
@@ -1,9 +1,13 @@
 #include "rapidcheck/detail/Platform.h"
 
-#ifndef _MSC_VER
+#ifdef _MSC_VER
+#include <direct.h>
+#else
 #include <cxxabi.h>
+#include <sys/stat.h>
 #endif // _MSC_VER
 
+#include <cerrno>
 #include <cstdlib>
 
 namespace rc {
@@ -61,6 +65,10 @@ Maybe<std::string> getEnvValue(const std::string &name) {
   }
 }
 
+bool makeDirectory(const std::string &path) {
+  return (_mkdir(path.c_str()) == 0) || (errno == EEXIST);
+}
+
 #else // _MSC_VER
 
 std::string demangle(const char *name) {
@@ -83,6 +91,10 @@ Maybe<std::string> getEnvValue(const std::string &name) {
   }
 }
 
+bool makeDirectory(const std::string &path) {
+  return (mkdir(path.c_str(), 0777) == 0) || (errno == EEXIST);
+}
+
 #endif // _MSC_VER
 
 } // namespace detail
@@ -1,13 +1,43 @@
 #include "rapidcheck/detail/Property.h"
 
 #include <algorithm>
+#include <streambuf>
 
 namespace rc {
 namespace detail {
 
+/// Unbuffered stream that appends everything written to it to a string.
+class AdapterContext::LogStream : private std::streambuf, public std::ostream {
+public:
+  explicit LogStream(std::string &log)
+      : std::ostream(this)
+      , m_log(log) {}
+
+protected:
+  using int_type = std::streambuf::int_type;
+  using traits_type = std::streambuf::traits_type;
+
+  int_type overflow(int_type c) override {
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      m_log.push_back(traits_type::to_char_type(c));
+    }
+    return traits_type::not_eof(c);
+  }
+
+  std::streamsize xsputn(const char *s, std::streamsize n) override {
+    m_log.append(s, static_cast<std::size_t>(n));
+    return n;
+  }
+
+private:
+  std::string &m_log;
+};
+
 AdapterContext::AdapterContext()
     : m_resultType(CaseResult::Type::Success) {}
 
+AdapterContext::~AdapterContext() = default;
+
 bool AdapterContext::reportResult(const CaseResult &result) {
   switch (result.type) {
   case CaseResult::Type::Discard:
@@ -48,7 +78,14 @@ bool AdapterContext::reportResult(const CaseResult &result) {
 }
 
 std::ostream &AdapterContext::logStream() {
-  return m_logStream;
+  if (!m_logStream) {
+    m_logStream.reset(new LogStream(m_log));
+  }
+  return *m_logStream;
+}
+
+void AdapterContext::appendLog(const char *data, std::size_t size) {
+  m_log.append(data, size);
 }
 
 void AdapterContext::addTag(std::string str) {
@@ -65,10 +102,9 @@ TaggedResult AdapterContext::result() const {
     result.result.description += std::move(*it);
   }
 
-  const auto log = m_logStream.str();
-  if (!log.empty()) {
+  if (!m_log.empty()) {
     result.result.description += "\n\nLog:\n";
-    result.result.description += log;
+    result.result.description += m_log;
   }
 
   result.tags = std::move(m_tags);
@@ -111,11 +147,13 @@ CaseResult toCaseResult(CaseResult caseResult) {
 
 namespace {
 
+using IngredientPtr = std::shared_ptr<const gen::detail::Recipe::Ingredient>;
+
 std::pair<std::string, std::string>
 tryDescribeIngredientValue(const gen::detail::Recipe::Ingredient &ingredient) {
   const auto value = ingredient.shrinkable.value();
 
-  std::string description = ingredient.description;
+  std::string description = *ingredient.description;
   if (description.empty()) {
     std::ostringstream typeString;
     value.showType(typeString);
@@ -129,11 +167,11 @@ tryDescribeIngredientValue(const gen::detail::Recipe::Ingredient &ingredient) {
 }
 
 std::pair<std::string, std::string>
-describeIngredient(const gen::detail::Recipe::Ingredient &ingredient) {
+describeIngredient(const IngredientPtr &ingredient) {
   // TODO I don't know if this is the right approach with counterexamples
   // even...
   try {
-    return tryDescribeIngredientValue(ingredient);
+    return tryDescribeIngredientValue(*ingredient);
   } catch (const GenerationFailure &e) {
     return {"Generation failed", e.what()};
   } catch (const std::exception &e) {
@@ -153,14 +191,15 @@ mapToCaseDescription(Gen<std::pair<TaggedResult, gen::detail::Recipe>> gen) {
                     description.result = std::move(p.first.result);
                     description.tags = std::move(p.first.tags);
 
-                    const auto ingredients = std::move(p.second.ingredients);
-                    description.example = [ingredients] {
+                    const auto recipe = std::move(p.second);
+                    description.example = [recipe] {
                       Example example;
-                      example.reserve(ingredients.size());
-                      std::transform(begin(ingredients),
-                                     end(ingredients),
-                                     std::back_inserter(example),
-                                     &describeIngredient);
+                      example.reserve(recipe.numIngredients());
+                      for (std::size_t i = 0; i < recipe.numIngredients();
+                           i++) {
+                        example.push_back(
+                            describeIngredient(recipe.ingredient(i)));
+                      }
                       return example;
                     };
 
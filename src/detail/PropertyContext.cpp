@@ -2,6 +2,11 @@
 
 namespace rc {
 namespace detail {
+
+void PropertyContext::appendLog(const char *data, std::size_t size) {
+  logStream().write(data, static_cast<std::streamsize>(size));
+}
+
 namespace param {
 namespace {
 
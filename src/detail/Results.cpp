@@ -56,12 +56,14 @@ bool operator!=(const CaseResult &r1, const CaseResult &r2) {
 
 std::ostream &operator<<(std::ostream &os, const detail::Reproduce &r) {
   os << "random={" << r.random << "}, size=" << r.size
+     << ", ddminThreshold=" << r.ddminThreshold
      << ", shrinkPath=" << toString(r.shrinkPath);
   return os;
 }
 
 bool operator==(const Reproduce &lhs, const Reproduce &rhs) {
   return (lhs.random == rhs.random) && (lhs.size == rhs.size) &&
+      (lhs.ddminThreshold == rhs.ddminThreshold) &&
       (lhs.shrinkPath == rhs.shrinkPath);
 }
 
@@ -131,7 +133,9 @@ void printResultMessage(const SuccessResult &result, std::ostream &os) {
 bool operator==(const FailureResult &r1, const FailureResult &r2) {
   return (r1.numSuccess == r2.numSuccess) &&
       (r1.description == r2.description) && (r1.reproduce == r2.reproduce) &&
-      (r1.counterExample == r2.counterExample);
+      (r1.counterExample == r2.counterExample) &&
+      (r1.numWastedShrinks == r2.numWastedShrinks) &&
+      (r1.partiallyShrunk == r2.partiallyShrunk);
 }
 
 bool operator!=(const FailureResult &r1, const FailureResult &r2) {
@@ -144,6 +148,8 @@ std::ostream &operator<<(std::ostream &os,
      << result.description << "'"
      << ", reproduce={" << result.reproduce << "}, counterExample=";
   show(result.counterExample, os);
+  os << ", numWastedShrinks=" << result.numWastedShrinks
+     << ", partiallyShrunk=" << result.partiallyShrunk;
   return os;
 }
 
@@ -156,6 +162,13 @@ void printResultMessage(const FailureResult &result, std::ostream &os) {
       os << 's';
     }
   }
+  if (result.partiallyShrunk) {
+    os << " (shrinking stopped early, counterexample may not be minimal)";
+  }
+  if (result.numWastedShrinks > 0) {
+    os << " (" << result.numWastedShrinks
+       << " speculative shrink evaluations wasted)";
+  }
 
   os << std::endl << std::endl;
 
@@ -26,5 +26,26 @@ stringToReproduceMap(const std::string &str) {
   return reproduceMap;
 }
 
+std::string reproduceToString(const Reproduce &reproduce) {
+  std::vector<std::uint8_t> data;
+  serialize(reproduce, std::back_inserter(data));
+  return base64Encode(data);
+}
+
+Reproduce stringToReproduce(const std::string &str) {
+  const auto data = base64Decode(str);
+  Reproduce reproduce;
+  try {
+    const auto it = deserialize(begin(data), end(data), reproduce);
+    if (it != end(data)) {
+      throw ParseException(0, "Trailing data");
+    }
+  } catch (const SerializationException &) {
+    throw ParseException(0, "Invalid format");
+  }
+
+  return reproduce;
+}
+
 } // namespace detail
 } // namespace rc
@@ -19,5 +19,13 @@ std::string reproduceMapToString(
 std::unordered_map<std::string, Reproduce>
 stringToReproduceMap(const std::string &str);
 
+/// Converts a single Reproduce value to a string.
+std::string reproduceToString(const Reproduce &reproduce);
+
+/// Converts a string to a single Reproduce value.
+///
+/// @throws ParseException on failure to parse.
+Reproduce stringToReproduce(const std::string &str);
+
 } // namespace detail
 } // namespace rc
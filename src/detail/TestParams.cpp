@@ -7,10 +7,19 @@ namespace rc {
 namespace detail {
 
 bool operator==(const TestParams &p1, const TestParams &p2) {
-  return (p1.seed == p2.seed) && (p1.maxSuccess == p2.maxSuccess) &&
+  return (p1.seed == p2.seed) && (p1.engine == p2.engine) &&
+      (p1.maxSuccess == p2.maxSuccess) &&
       (p1.maxSize == p2.maxSize) &&
       (p1.maxDiscardRatio == p2.maxDiscardRatio) &&
-      (p1.disableShrinking == p2.disableShrinking);
+      (p1.disableShrinking == p2.disableShrinking) &&
+      (p1.numThreads == p2.numThreads) &&
+      (p1.numShrinkThreads == p2.numShrinkThreads) &&
+      (p1.maxTime == p2.maxTime) && (p1.maxShrinkTime == p2.maxShrinkTime) &&
+      (p1.maxShrinkSteps == p2.maxShrinkSteps) &&
+      (p1.cacheShrinks == p2.cacheShrinks) &&
+      (p1.poolAllocation == p2.poolAllocation) &&
+      (p1.commandStats == p2.commandStats) &&
+      (p1.ddminThreshold == p2.ddminThreshold);
 }
 
 bool operator!=(const TestParams &p1, const TestParams &p2) {
@@ -18,10 +27,21 @@ bool operator!=(const TestParams &p1, const TestParams &p2) {
 }
 
 std::ostream &operator<<(std::ostream &os, const TestParams &params) {
-  os << "seed=" << params.seed << ", maxSuccess=" << params.maxSuccess
+  os << "seed=" << params.seed << ", engine="
+     << ((params.engine == Random::Engine::Fast) ? "fast" : "default")
+     << ", maxSuccess=" << params.maxSuccess
      << ", maxSize=" << params.maxSize
      << ", maxDiscardRatio=" << params.maxDiscardRatio
-     << ", disableShrinking=" << params.disableShrinking;
+     << ", disableShrinking=" << params.disableShrinking
+     << ", numThreads=" << params.numThreads
+     << ", numShrinkThreads=" << params.numShrinkThreads
+     << ", maxTime=" << params.maxTime
+     << ", maxShrinkTime=" << params.maxShrinkTime
+     << ", maxShrinkSteps=" << params.maxShrinkSteps
+     << ", cacheShrinks=" << params.cacheShrinks
+     << ", poolAllocation=" << params.poolAllocation
+     << ", commandStats=" << params.commandStats
+     << ", ddminThreshold=" << params.ddminThreshold;
   return os;
 }
 
@@ -1,6 +1,18 @@
 #include "Testing.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+
 #include "rapidcheck/BeforeMinimalTestCase.h"
+#include "rapidcheck/detail/ImplPool.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
 #include "rapidcheck/shrinkable/Operations.h"
 
 namespace rc {
@@ -26,24 +38,288 @@ int sizeFor(const TestParams &params, int i) {
   }
 }
 
+/// Returns the size to use for the next test case given the number of
+/// successful test cases so far and the number of test cases that have been
+/// discarded since the last successful one.
+int caseSize(const TestParams &params, int numSuccess, int recentDiscards) {
+  return sizeFor(params, numSuccess) + (recentDiscards / 10);
+}
+
+/// A point in time after which work should stop. A time limit of zero means
+/// that there is no deadline.
+class Deadline {
+public:
+  explicit Deadline(int milliseconds)
+      : m_enabled(milliseconds > 0)
+      , m_end(Clock::now() + std::chrono::milliseconds(milliseconds)) {}
+
+  bool hasPassed() const { return m_enabled && (Clock::now() >= m_end); }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  bool m_enabled;
+  Clock::time_point m_end;
+};
+
+/// Searches a property using several threads. Test cases are handed out by
+/// index and the results are committed strictly in index order so that the
+/// outcome does not depend on the number of threads or on scheduling. The
+/// `Random` for a given index is the same one that a serial search would use.
+/// The size of a test case depends on the results of the ones before it, so it
+/// is predicted assuming that every test case in flight succeeds. If that turns
+/// out to be wrong when the test case is committed, it is run again with the
+/// right size before anything after it is committed.
+class ParallelSearch {
+public:
+  ParallelSearch(const Property &property,
+                 const TestParams &params,
+                 TestListener &listener)
+      : m_property(property)
+      , m_params(params)
+      , m_listener(listener)
+      , m_maxDiscard(params.maxDiscardRatio * params.maxSuccess)
+      , m_deadline(params.maxTime)
+      , m_random(params.seed, params.engine)
+      , m_nextIndex(0)
+      , m_numCommitted(0)
+      , m_recentDiscards(0)
+      , m_firstFailure(kNoFailure)
+      , m_stopDispatch(false)
+      , m_done(params.maxSuccess <= 0) {
+    m_result.type = SearchResult::Type::Success;
+    m_result.numSuccess = 0;
+    m_result.numDiscarded = 0;
+  }
+
+  SearchResult run() {
+    std::vector<std::thread> threads;
+    threads.reserve(m_params.numThreads - 1);
+    for (int i = 1; i < m_params.numThreads; i++) {
+      threads.emplace_back([this] {
+        ImplPoolScope poolScope(m_params.poolAllocation);
+        ImplicitParam<gen::detail::param::ValuesOnly> letValuesOnly(
+            m_params.disableShrinking);
+        ImplicitParam<gen::detail::param::DdminThreshold> letDdminThreshold(
+            m_params.ddminThreshold);
+        work();
+      });
+    }
+    work();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    if (m_exception) {
+      std::rethrow_exception(m_exception);
+    }
+    return std::move(m_result);
+  }
+
+private:
+  static constexpr uint64_t kNoFailure = std::numeric_limits<uint64_t>::max();
+
+  struct PendingCase {
+    uint64_t index;
+    Random random;
+    int size;
+  };
+
+  struct FinishedCase {
+    Shrinkable<CaseDescription> shrinkable;
+    CaseDescription description;
+    int size;
+    Random random;
+  };
+
+  // Must be called with the lock held. We never keep more test cases in flight
+  // than the number of successes that are still needed since the surplus would
+  // most likely be wasted. Test cases after a failing one can never affect the
+  // result.
+  int numPending() const {
+    return static_cast<int>(m_nextIndex - m_numCommitted);
+  }
+
+  bool canDispatch() const {
+    return !m_stopDispatch && (m_nextIndex < m_firstFailure) &&
+        (numPending() < (m_params.maxSuccess - m_result.numSuccess));
+  }
+
+  // Must be called with the lock held.
+  PendingCase nextCase() {
+    if (!m_rerun.empty()) {
+      auto pending = std::move(m_rerun.back());
+      m_rerun.pop_back();
+      return pending;
+    }
+
+    // Assume that every test case in flight will succeed
+    const auto numPredicted = numPending();
+    const auto size = caseSize(m_params,
+                               m_result.numSuccess + numPredicted,
+                               (numPredicted == 0) ? m_recentDiscards : 0);
+    return PendingCase{m_nextIndex++, m_random.split(), size};
+  }
+
+  // Must be called with the lock held.
+  void updateFirstFailure() {
+    m_firstFailure = kNoFailure;
+    for (const auto &entry : m_finished) {
+      if (entry.second.description.result.type == CaseResult::Type::Failure) {
+        m_firstFailure = entry.first;
+        return;
+      }
+    }
+  }
+
+  void work() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      if (!m_done && m_deadline.hasPassed()) {
+        // Let the cases in flight finish but don't start any new ones
+        m_stopDispatch = true;
+        if (m_nextIndex == m_numCommitted) {
+          m_done = true;
+          m_cond.notify_all();
+        }
+      }
+
+      m_cond.wait(lock, [this] {
+        return m_done || !m_rerun.empty() || canDispatch();
+      });
+      if (m_done) {
+        return;
+      }
+
+      const auto pending = nextCase();
+      lock.unlock();
+
+      try {
+        auto shrinkable = m_property(pending.random, pending.size);
+        auto description = shrinkable.value();
+        lock.lock();
+        if ((description.result.type == CaseResult::Type::Failure) &&
+            (pending.index < m_firstFailure)) {
+          m_firstFailure = pending.index;
+        }
+        m_finished.emplace(pending.index,
+                           FinishedCase{std::move(shrinkable),
+                                        std::move(description),
+                                        pending.size,
+                                        pending.random});
+        commitFinished();
+      } catch (...) {
+        if (!lock.owns_lock()) {
+          lock.lock();
+        }
+        if (!m_exception) {
+          m_exception = std::current_exception();
+        }
+        m_done = true;
+      }
+
+      m_cond.notify_all();
+    }
+  }
+
+  // Must be called with the lock held.
+  void commitFinished() {
+    while (!m_done) {
+      const auto it = m_finished.find(m_numCommitted);
+      if (it == end(m_finished)) {
+        return;
+      }
+
+      auto &finished = it->second;
+      const auto size =
+          caseSize(m_params, m_result.numSuccess, m_recentDiscards);
+      if (finished.size != size) {
+        // The prediction was wrong so this has to be run again
+        m_rerun.push_back(PendingCase{it->first, finished.random, size});
+        m_finished.erase(it);
+        updateFirstFailure();
+        return;
+      }
+
+      m_listener.onTestCaseFinished(finished.description);
+      switch (finished.description.result.type) {
+      case CaseResult::Type::Failure:
+        m_result.type = SearchResult::Type::Failure;
+        m_result.failure = SearchResult::Failure(
+            std::move(finished.shrinkable), finished.size, finished.random);
+        m_done = true;
+        break;
+
+      case CaseResult::Type::Discard:
+        m_result.numDiscarded++;
+        m_recentDiscards++;
+        if (m_result.numDiscarded > m_maxDiscard) {
+          m_result.type = SearchResult::Type::GaveUp;
+          m_result.failure = SearchResult::Failure(
+              std::move(finished.shrinkable), finished.size, finished.random);
+          m_done = true;
+        }
+        break;
+
+      case CaseResult::Type::Success:
+        m_result.numSuccess++;
+        m_recentDiscards = 0;
+        if (!finished.description.tags.empty()) {
+          m_result.distribution.add(finished.description.tags);
+        }
+        m_done = m_result.numSuccess >= m_params.maxSuccess;
+        break;
+      }
+
+      m_finished.erase(it);
+      m_numCommitted++;
+    }
+  }
+
+  const Property &m_property;
+  const TestParams &m_params;
+  TestListener &m_listener;
+  const int m_maxDiscard;
+  const Deadline m_deadline;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  Random m_random;
+  uint64_t m_nextIndex;
+  uint64_t m_numCommitted;
+  int m_recentDiscards;
+  uint64_t m_firstFailure;
+  std::vector<PendingCase> m_rerun;
+  std::map<uint64_t, FinishedCase> m_finished;
+  bool m_stopDispatch;
+  bool m_done;
+  std::exception_ptr m_exception;
+  SearchResult m_result;
+};
+
 } // namespace
 
 SearchResult searchProperty(const Property &property,
                             const TestParams &params,
                             TestListener &listener) {
+  if (params.numThreads > 1) {
+    return ParallelSearch(property, params, listener).run();
+  }
+
   SearchResult searchResult;
   searchResult.type = SearchResult::Type::Success;
   searchResult.numSuccess = 0;
   searchResult.numDiscarded = 0;
-  searchResult.tags.reserve(params.maxSuccess);
 
   const auto maxDiscard = params.maxDiscardRatio * params.maxSuccess;
 
+  const Deadline deadline(params.maxTime);
   auto recentDiscards = 0;
-  auto r = Random(params.seed);
-  while (searchResult.numSuccess < params.maxSuccess) {
+  auto r = Random(params.seed, params.engine);
+  while ((searchResult.numSuccess < params.maxSuccess) &&
+         !deadline.hasPassed()) {
     const auto size =
-        sizeFor(params, searchResult.numSuccess) + (recentDiscards / 10);
+        caseSize(params, searchResult.numSuccess, recentDiscards);
     const auto random = r.split();
 
     auto shrinkable = property(random, size);
@@ -73,7 +349,7 @@ SearchResult searchProperty(const Property &property,
       searchResult.numSuccess++;
       recentDiscards = 0;
       if (!caseDescription.tags.empty()) {
-        searchResult.tags.push_back(std::move(caseDescription.tags));
+        searchResult.distribution.add(caseDescription.tags);
       }
       break;
     }
@@ -82,43 +358,296 @@ SearchResult searchProperty(const Property &property,
   return searchResult;
 }
 
-std::pair<Shrinkable<CaseDescription>, std::vector<std::size_t>>
-shrinkTestCase(const Shrinkable<CaseDescription> &shrinkable,
-               TestListener &listener) {
-  std::vector<std::size_t> path;
-  Shrinkable<CaseDescription> best = shrinkable;
+namespace {
+
+/// Returns the number of shrinks that may still be tried given that `numTried`
+/// shrinks have been tried so far.
+std::size_t remainingShrinkSteps(const TestParams &params, int numTried) {
+  if (params.maxShrinkSteps <= 0) {
+    return std::numeric_limits<std::size_t>::max();
+  }
+
+  return static_cast<std::size_t>(
+      std::max(params.maxShrinkSteps - numTried, 0));
+}
 
+ShrinkResult shrinkSerially(const Shrinkable<CaseDescription> &shrinkable,
+                            const TestParams &params,
+                            TestListener &listener) {
+  const Deadline deadline(params.maxShrinkTime);
+  ShrinkResult result(shrinkable);
   auto shrinks = shrinkable.shrinks();
   std::size_t i = 0;
+  int numTried = 0;
   while (auto shrink = shrinks.next()) {
+    if ((remainingShrinkSteps(params, numTried) == 0) ||
+        deadline.hasPassed()) {
+      result.partial = true;
+      break;
+    }
+
+    numTried++;
     auto caseDescription = shrink->value();
     bool accept = caseDescription.result.type == CaseResult::Type::Failure;
     listener.onShrinkTried(caseDescription, accept);
     if (accept) {
-      best = std::move(*shrink);
-      shrinks = best.shrinks();
-      path.push_back(i);
+      result.shrinkable = std::move(*shrink);
+      shrinks = result.shrinkable.shrinks();
+      result.path.push_back(i);
       i = 0;
     } else {
       i++;
     }
   }
 
-  return std::make_pair(std::move(best), std::move(path));
+  return result;
+}
+
+/// Evaluates batches of shrink candidates concurrently on a set of worker
+/// threads that lives as long as this object so that threads are not created
+/// for every batch.
+class CandidateEvaluator {
+public:
+  explicit CandidateEvaluator(int numThreads)
+      // Implicit parameters are per thread so the cache has to be passed on
+      : m_cache(ImplicitParam<param::CurrentEvaluationCache>::value())
+      , m_ddminThreshold(
+            ImplicitParam<gen::detail::param::DdminThreshold>::value())
+      , m_pooled(ImplPool::isEnabled())
+      , m_candidates(nullptr)
+      , m_descriptions(nullptr)
+      , m_batch(0)
+      , m_numDone(0)
+      , m_stop(false)
+      , m_nextIndex(0)
+      , m_firstFailure(0)
+      , m_numEvaluated(0) {
+    m_threads.reserve(numThreads - 1);
+    for (int i = 1; i < numThreads; i++) {
+      m_threads.emplace_back([this] { workerLoop(); });
+    }
+  }
+
+  ~CandidateEvaluator() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_cond.notify_all();
+    for (auto &thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  /// Evaluates the given candidates. A candidate is skipped if a candidate
+  /// before it is already known to fail since it can never be accepted then.
+  /// Returns the number of candidates that were evaluated.
+  std::size_t
+  evaluate(const std::vector<Shrinkable<CaseDescription>> &candidates,
+           std::vector<Maybe<CaseDescription>> &descriptions) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_candidates = &candidates;
+      m_descriptions = &descriptions;
+      m_nextIndex = 0;
+      m_firstFailure = candidates.size();
+      m_numEvaluated = 0;
+      m_numDone = 0;
+      m_exception = nullptr;
+      m_batch++;
+    }
+    m_cond.notify_all();
+
+    work();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCond.wait(lock, [this] { return m_numDone == m_threads.size(); });
+    if (m_exception) {
+      std::rethrow_exception(m_exception);
+    }
+    return m_numEvaluated;
+  }
+
+private:
+  RC_DISABLE_COPY(CandidateEvaluator)
+
+  void workerLoop() {
+    ImplicitParam<param::CurrentEvaluationCache> letCache(m_cache);
+    ImplicitParam<gen::detail::param::DdminThreshold> letDdminThreshold(
+        m_ddminThreshold);
+    ImplPoolScope poolScope(m_pooled);
+    uint64_t batch = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cond.wait(lock, [&] { return m_stop || (m_batch != batch); });
+        if (m_stop) {
+          return;
+        }
+        batch = m_batch;
+      }
+
+      work();
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_numDone++;
+      }
+      m_doneCond.notify_one();
+    }
+  }
+
+  void work() {
+    const auto &candidates = *m_candidates;
+    auto &descriptions = *m_descriptions;
+    const auto numCandidates = candidates.size();
+    while (true) {
+      const auto index = m_nextIndex++;
+      if ((index >= numCandidates) || (index > m_firstFailure)) {
+        return;
+      }
+
+      try {
+        descriptions[index] = candidates[index].value();
+        m_numEvaluated++;
+        if (descriptions[index]->result.type == CaseResult::Type::Failure) {
+          auto current = m_firstFailure.load();
+          while ((index < current) &&
+                 !m_firstFailure.compare_exchange_weak(current, index)) {
+          }
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_exception) {
+          m_exception = std::current_exception();
+        }
+        // Make everyone stop
+        m_firstFailure = 0;
+        return;
+      }
+    }
+  }
+
+  EvaluationCache *const m_cache;
+  const int m_ddminThreshold;
+  const bool m_pooled;
+  std::vector<std::thread> m_threads;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cond;
+  std::condition_variable m_doneCond;
+  const std::vector<Shrinkable<CaseDescription>> *m_candidates;
+  std::vector<Maybe<CaseDescription>> *m_descriptions;
+  uint64_t m_batch;
+  std::size_t m_numDone;
+  bool m_stop;
+  std::exception_ptr m_exception;
+
+  std::atomic<std::size_t> m_nextIndex;
+  std::atomic<std::size_t> m_firstFailure;
+  std::atomic<std::size_t> m_numEvaluated;
+};
+
+/// Evaluates up to `numThreads` shrinks at a time but accepts them in the same
+/// order as `shrinkSerially` so that the resulting path is identical.
+ShrinkResult shrinkConcurrently(const Shrinkable<CaseDescription> &shrinkable,
+                                const TestParams &params,
+                                TestListener &listener) {
+  const Deadline deadline(params.maxShrinkTime);
+  ShrinkResult result(shrinkable);
+  auto shrinks = shrinkable.shrinks();
+  std::size_t i = 0;
+  int numTried = 0;
+  std::vector<Shrinkable<CaseDescription>> candidates;
+  std::vector<Maybe<CaseDescription>> descriptions;
+  CandidateEvaluator evaluator(params.numShrinkThreads);
+  while (auto shrink = shrinks.next()) {
+    const auto maxCandidates =
+        std::min(static_cast<std::size_t>(params.numShrinkThreads),
+                 remainingShrinkSteps(params, numTried));
+    if ((maxCandidates == 0) || deadline.hasPassed()) {
+      result.partial = true;
+      break;
+    }
+
+    candidates.clear();
+    candidates.push_back(std::move(*shrink));
+    while (candidates.size() < maxCandidates) {
+      auto nextShrink = shrinks.next();
+      if (!nextShrink) {
+        break;
+      }
+      candidates.push_back(std::move(*nextShrink));
+    }
+
+    descriptions.clear();
+    descriptions.resize(candidates.size());
+    auto numUnused = evaluator.evaluate(candidates, descriptions);
+    bool accepted = false;
+    for (std::size_t j = 0; j < candidates.size(); j++) {
+      // Every candidate before the first failing one has been evaluated
+      const auto &caseDescription = *descriptions[j];
+      numUnused--;
+      numTried++;
+      bool accept = caseDescription.result.type == CaseResult::Type::Failure;
+      listener.onShrinkTried(caseDescription, accept);
+      if (accept) {
+        result.shrinkable = std::move(candidates[j]);
+        shrinks = result.shrinkable.shrinks();
+        result.path.push_back(i + j);
+        result.numWastedShrinks += static_cast<int>(numUnused);
+        i = 0;
+        accepted = true;
+        break;
+      }
+    }
+
+    if (!accepted) {
+      i += candidates.size();
+    }
+  }
+
+  return result;
+}
+
+} // namespace
+
+ShrinkResult shrinkTestCase(const Shrinkable<CaseDescription> &shrinkable,
+                            const TestParams &params,
+                            TestListener &listener) {
+  const auto shrink = [&] {
+    return (params.numShrinkThreads > 1)
+        ? shrinkConcurrently(shrinkable, params, listener)
+        : shrinkSerially(shrinkable, params, listener);
+  };
+
+  if (!params.cacheShrinks) {
+    return shrink();
+  }
+
+  EvaluationCache cache;
+  ImplicitParam<param::CurrentEvaluationCache> letCache(&cache);
+  auto result = shrink();
+  listener.onShrinkCacheStats(cache.numHits(), cache.numMisses());
+  return result;
 }
 
 namespace {
 
-TestResult doTestProperty(const Property &property,
-                          const TestParams &params,
-                          TestListener &listener) {
+TestResult searchAndShrinkProperty(const Property &property,
+                                   const TestParams &params,
+                                   TestListener &listener) {
+  ImplPoolScope poolScope(params.poolAllocation);
+  // Nothing will ever be shrunk so there is no need to build shrink trees
+  ImplicitParam<gen::detail::param::ValuesOnly> letValuesOnly(
+      params.disableShrinking);
+  ImplicitParam<gen::detail::param::DdminThreshold> letDdminThreshold(
+      params.ddminThreshold);
   const auto searchResult = searchProperty(property, params, listener);
   if (searchResult.type == SearchResult::Type::Success) {
     SuccessResult success;
     success.numSuccess = searchResult.numSuccess;
-    for (const auto &tags : searchResult.tags) {
-      success.distribution[tags]++;
-    }
+    success.distribution = searchResult.distribution.distribution();
     return success;
   } else if (searchResult.type == SearchResult::Type::GaveUp) {
     GaveUpResult gaveUp;
@@ -130,26 +659,44 @@ TestResult doTestProperty(const Property &property,
     // Shrink it unless shrinking is disabled
     const auto &shrinkable = searchResult.failure->shrinkable;
     auto shrinkResult = params.disableShrinking
-        ? std::make_pair(shrinkable, std::vector<std::size_t>())
-        : shrinkTestCase(shrinkable, listener);
+        ? ShrinkResult(shrinkable)
+        : shrinkTestCase(shrinkable, params, listener);
 
     // Give the developer a chance to set a breakpoint before the final minimal
     // test case is run
     beforeMinimalTestCase();
     // ...and here we actually run it
-    const auto caseDescription = shrinkResult.first.value();
+    const auto caseDescription = shrinkResult.shrinkable.value();
 
     FailureResult failure;
     failure.numSuccess = searchResult.numSuccess;
     failure.description = std::move(caseDescription.result.description);
     failure.reproduce.random = searchResult.failure->random;
     failure.reproduce.size = searchResult.failure->size;
-    failure.reproduce.shrinkPath = std::move(shrinkResult.second);
+    failure.reproduce.ddminThreshold = params.ddminThreshold;
+    failure.reproduce.shrinkPath = std::move(shrinkResult.path);
     failure.counterExample = caseDescription.example();
+    failure.numWastedShrinks = shrinkResult.numWastedShrinks;
+    failure.partiallyShrunk = shrinkResult.partial;
     return failure;
   }
 }
 
+TestResult doTestProperty(const Property &property,
+                          const TestParams &params,
+                          TestListener &listener) {
+  // Disable recording explicitly so that the commands of a nested test do not
+  // end up in the stats of an outer one
+  CommandStatsRecorder recorder;
+  CommandStatsScope commandStatsScope(params.commandStats ? &recorder
+                                                          : nullptr);
+  auto result = searchAndShrinkProperty(property, params, listener);
+  if (params.commandStats) {
+    listener.onCommandStats(recorder.stats());
+  }
+  return result;
+}
+
 } // namespace
 
 TestResult testProperty(const Property &property,
@@ -161,8 +708,51 @@ TestResult testProperty(const Property &property,
   return result;
 }
 
+TestResult testProperty(const Property &property,
+                        const TestMetadata &metadata,
+                        const TestParams &params,
+                        TestListener &listener,
+                        ExampleDatabase &database) {
+  if (metadata.id.empty()) {
+    return testProperty(property, metadata, params, listener);
+  }
+
+  // Replay every stored failure, not just up to the first one that still
+  // fails, so that we can prune the ones that have been fixed
+  const auto entries = database.load(metadata.id);
+  std::vector<Reproduce> stillFailing;
+  Maybe<TestResult> replayed;
+  for (const auto &entry : entries) {
+    auto result = reproduceProperty(property, entry);
+    if (result.is<FailureResult>()) {
+      stillFailing.push_back(entry);
+      if (!replayed) {
+        replayed = std::move(result);
+      }
+    }
+  }
+
+  if (stillFailing.size() != entries.size()) {
+    database.store(metadata.id, stillFailing);
+  }
+
+  TestResult result = replayed ? std::move(*replayed)
+                               : doTestProperty(property, params, listener);
+  FailureResult failure;
+  if (!replayed && result.match(failure)) {
+    database.add(metadata.id, failure.reproduce);
+  }
+
+  listener.onTestFinished(metadata, result);
+  return result;
+}
+
 TestResult reproduceProperty(const Property &property,
                              const Reproduce &reproduce) {
+  // The shrinks of containers depend on this so it must be the same as when
+  // the shrink path was recorded
+  ImplicitParam<gen::detail::param::DdminThreshold> letDdminThreshold(
+      reproduce.ddminThreshold);
   const auto shrinkable = property(reproduce.random, reproduce.size);
   const auto minShrinkable =
       shrinkable::walkPath(shrinkable, reproduce.shrinkPath);
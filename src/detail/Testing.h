@@ -8,6 +8,8 @@
 #include "rapidcheck/detail/Property.h"
 #include "rapidcheck/detail/TestParams.h"
 #include "rapidcheck/detail/TestListener.h"
+#include "DistributionCounter.h"
+#include "ExampleDatabase.h"
 
 namespace rc {
 namespace detail {
@@ -41,14 +43,19 @@ struct SearchResult {
   /// The number of discarded test cases.
   int numDiscarded;
 
-  /// The tags of successful test cases.
-  std::vector<Tags> tags;
+  /// The distribution of tags of successful test cases. Test cases without
+  /// tags are not counted.
+  DistributionCounter distribution;
 
   /// On Failure or GiveUp, contains failure information.
   Maybe<Failure> failure;
 };
 
-/// Searches for a failure in the given property.
+/// Searches for a failure in the given property. If `params.maxTime` is set,
+/// the search stops when it runs out of time even if fewer than
+/// `params.maxSuccess` test cases have been run. If `params.numThreads` is
+/// greater than one, test cases are run concurrently and the property must be
+/// safe to call from several threads at once.
 ///
 /// @param property  The property to search.
 /// @param params    The test parameters to use.
@@ -59,15 +66,44 @@ SearchResult searchProperty(const Property &property,
                             const TestParams &params,
                             TestListener &listener);
 
-/// Shrinks the given case description shrinkable.
+struct ShrinkResult {
+  explicit ShrinkResult(Shrinkable<CaseDescription> shr)
+      : shrinkable(std::move(shr))
+      , numWastedShrinks(0)
+      , partial(false) {}
+
+  /// The final shrink.
+  Shrinkable<CaseDescription> shrinkable;
+
+  /// The path leading to the final shrink.
+  std::vector<std::size_t> path;
+
+  /// The number of shrinks that were evaluated speculatively but never tried
+  /// since a shrink before them was accepted.
+  int numWastedShrinks;
+
+  /// Whether shrinking was stopped because the shrink budget ran out and the
+  /// final shrink may thus not be minimal.
+  bool partial;
+};
+
+/// Shrinks the given case description shrinkable. If `params.numShrinkThreads`
+/// is greater than one, that many shrinks are evaluated concurrently. The
+/// resulting path is the same regardless. Shrinking stops early with the best
+/// shrink found so far if `params.maxShrinkTime` or `params.maxShrinkSteps` is
+/// exceeded. If `params.cacheShrinks` is set, shrinks that are identical to an
+/// earlier shrink that did not fail are not evaluated again and the number of
+/// cache hits and misses is reported to the listener.
 ///
 /// @param shrinkable  The shrinkable to shrink.
+/// @param params      The test parameters.
 /// @param listener    A test listener to report progress to.
 ///
-/// @return A pair of the final shrink as well as the path leading there.
-std::pair<Shrinkable<CaseDescription>, std::vector<std::size_t>>
-shrinkTestCase(const Shrinkable<CaseDescription> &shrinkable,
-               TestListener &listener);
+/// @return A `ShrinkResult` describing the final shrink and the path leading
+///         there.
+ShrinkResult shrinkTestCase(const Shrinkable<CaseDescription> &shrinkable,
+                            const TestParams &params,
+                            TestListener &listener);
 
 /// Combined search and shrink. Returns a test result.
 ///
@@ -80,6 +116,17 @@ TestResult testProperty(const Property &property,
                         const TestParams &params,
                         TestListener &listener);
 
+/// Like `testProperty` but first replays the failures stored for the test in
+/// the given database. If any of them still fails, that failure is returned
+/// without searching for new ones. Stored failures that no longer fail are
+/// removed from the database and any new failure that is found is added to it.
+/// Tests without an ID are tested without using the database.
+TestResult testProperty(const Property &property,
+                        const TestMetadata &metadata,
+                        const TestParams &params,
+                        TestListener &listener,
+                        ExampleDatabase &database);
+
 /// Reproduces a test result for the given property using a `Reproduce` value.
 TestResult reproduceProperty(const Property &property,
                              const Reproduce &reproduce);
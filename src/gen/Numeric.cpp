@@ -24,9 +24,13 @@ integral<unsigned long long>(const Random &random, int size);
 template Shrinkable<float> real<float>(const Random &random, int size);
 template Shrinkable<double> real<double>(const Random &random, int size);
 
-Shrinkable<bool> boolean(const Random &random, int /*size*/) {
-  return shrinkable::shrinkRecur(rc::detail::bitStreamOf(random).next<bool>(),
-                                 &shrink::boolean);
+bool booleanValue(const Random &random, int /*size*/) {
+  return rc::detail::bitStreamOf(random).next<bool>();
+}
+
+Shrinkable<bool> boolean(const Random &random, int size) {
+  return shrinkRecurUnlessValuesOnly(booleanValue(random, size),
+                                     &shrink::boolean);
 }
 
 } // namespace detail
@@ -1,6 +1,8 @@
 #include "rapidcheck/gen/detail/ExecHandler.h"
 
 #include "rapidcheck/Gen.h"
+#include "rapidcheck/detail/PropertyContext.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
 
 namespace rc {
 namespace gen {
@@ -9,18 +11,28 @@ namespace detail {
 ExecHandler::ExecHandler(Recipe &recipe)
     : m_recipe(recipe)
     , m_random(m_recipe.random)
-    , m_it(begin(m_recipe.ingredients)) {}
+    , m_valuesOnly(rc::detail::ImplicitParam<param::ValuesOnly>::value())
+    , m_next(0) {}
 
 rc::detail::Any ExecHandler::onGenerate(const Gen<rc::detail::Any> &gen) {
-  rc::detail::ImplicitScope newScope;
+  // A full `ImplicitScope` would reset every implicit parameter, including the
+  // test parameters that generators should see, so only the parameters that
+  // belong to the surrounding evaluation are reset
+  rc::detail::ImplicitParam<param::CurrentHandler> letHandler(
+      param::CurrentHandler::defaultValue());
+  rc::detail::ImplicitParam<rc::detail::param::CurrentPropertyContext>
+      letContext(rc::detail::param::CurrentPropertyContext::defaultValue());
+  // `execRaw` disables the mode for its callable so it is restored to what it
+  // was outside. The values of some generators are only computed when asked
+  // for so this must also cover the call to `value()` below
+  rc::detail::ImplicitParam<param::ValuesOnly> letValuesOnly(m_valuesOnly);
 
   Random random = m_random.split();
-  if (m_it == end(m_recipe.ingredients)) {
-    m_it = m_recipe.ingredients.emplace(
-        m_it, gen.name(), gen(random, m_recipe.size));
+  if (m_next == m_recipe.numIngredients()) {
+    m_recipe.added.push_back(std::make_shared<const Recipe::Ingredient>(
+        gen.name(), gen(random, m_recipe.size)));
   }
-  auto current = m_it++;
-  return current->shrinkable.value();
+  return m_recipe.ingredient(m_next++)->value();
 }
 
 } // namespace detail
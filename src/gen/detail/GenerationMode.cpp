@@ -0,0 +1,16 @@
+#include "rapidcheck/gen/detail/GenerationMode.h"
+
+namespace rc {
+namespace gen {
+namespace detail {
+namespace param {
+
+bool ValuesOnly::defaultValue() { return false; }
+
+int DdminThreshold::defaultValue() { return 0; }
+
+} // namespace param
+
+} // namespace detail
+} // namespace gen
+} // namespace rc
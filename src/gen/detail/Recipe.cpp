@@ -7,25 +7,64 @@ namespace rc {
 namespace gen {
 namespace detail {
 
+namespace {
+
+/// Returns all the ingredients of the recipe as a single shared vector so that
+/// the shrinks of the recipe can share them instead of copying them.
+std::shared_ptr<const Recipe::Ingredients> freeze(const Recipe &recipe) {
+  if (recipe.added.empty() && recipe.shared &&
+      (recipe.numShared == recipe.shared->size())) {
+    return recipe.shared;
+  }
+
+  auto ingredients = std::make_shared<Recipe::Ingredients>();
+  ingredients->reserve(recipe.numIngredients());
+  if (recipe.shared) {
+    ingredients->insert(end(*ingredients),
+                        begin(*recipe.shared),
+                        begin(*recipe.shared) + recipe.numShared);
+  }
+  ingredients->insert(
+      end(*ingredients), begin(recipe.added), end(recipe.added));
+  return ingredients;
+}
+
+} // namespace
+
 Seq<Recipe> shrinkRecipe(const Recipe &recipe) {
   using Any = rc::detail::Any;
 
+  const auto random = recipe.random;
+  const auto size = recipe.size;
+  const auto ingredients = freeze(recipe);
   return seq::mapcat(
-      seq::range<std::size_t>(recipe.numFixed, recipe.ingredients.size()),
+      seq::range<std::size_t>(recipe.numFixed, ingredients->size()),
       [=](std::size_t i) {
-        return seq::map(recipe.ingredients[i].shrinkable.shrinks(),
+        const auto &ingredient = (*ingredients)[i];
+        return seq::map(ingredient->shrinks(),
                         [=](Shrinkable<Any> &&shrink) {
-                          Recipe shrunkRecipe(recipe);
-                          const auto it = begin(shrunkRecipe.ingredients) + i;
-                          it->shrinkable = std::move(shrink);
-                          shrunkRecipe.ingredients.erase(
-                              it + 1, end(shrunkRecipe.ingredients));
+                          Recipe shrunkRecipe;
+                          shrunkRecipe.random = random;
+                          shrunkRecipe.size = size;
+                          // Only the shrunk ingredient is new, the ones before
+                          // it are shared with the original recipe
+                          shrunkRecipe.shared = ingredients;
+                          shrunkRecipe.numShared = i;
+                          shrunkRecipe.added.push_back(
+                              std::make_shared<const Recipe::Ingredient>(
+                                  ingredient->description, std::move(shrink)));
                           shrunkRecipe.numFixed = i;
                           return shrunkRecipe;
                         });
       });
 }
 
+namespace param {
+
+const Recipe *CurrentRecipe::defaultValue() { return nullptr; }
+
+} // namespace param
+
 } // namespace detail
 } // namespace gen
 } // namespace rc
@@ -18,6 +18,17 @@ bool descriptionContains(const CaseResult &result, const std::string &substr) {
   return stringContains(result.description, substr);
 }
 
+struct RecordingPropertyContext : public PropertyContext {
+  bool reportResult(const CaseResult &result) override {
+    results.push_back(result);
+    return true;
+  }
+  std::ostream &logStream() override { return std::cerr; }
+  void addTag(std::string str) override {}
+
+  std::vector<CaseResult> results;
+};
+
 } // namespace
 
 TEST_CASE("makeMessage") {
@@ -326,3 +337,111 @@ TEST_CASE("assertions") {
     }
   }
 }
+
+TEST_CASE("returning assertions") {
+  int x = 0;
+  bool returned = true;
+  RecordingPropertyContext context;
+  ImplicitParam<param::CurrentPropertyContext> letContext(&context);
+
+  SECTION("RC_ASSERT_RETURN") {
+    SECTION("does nothing if expression is true") {
+      [&] {
+        RC_ASSERT_RETURN(100 == 100);
+        returned = false;
+      }();
+      REQUIRE(!returned);
+      REQUIRE(context.results.empty());
+    }
+
+    SECTION("when false, reports Failure with relevant info and returns") {
+      [&] {
+        RC_ASSERT_RETURN(x++ == 100);
+        returned = false;
+      }();
+      REQUIRE(returned);
+      REQUIRE(context.results.size() == 1);
+      const auto &result = context.results.front();
+      REQUIRE(result.type == CaseResult::Type::Failure);
+      REQUIRE(descriptionContains(result, "0 == 100"));
+      REQUIRE(descriptionContains(result, "RC_ASSERT_RETURN(x++ == 100)"));
+    }
+  }
+
+  SECTION("RC_FAIL_RETURN") {
+    SECTION("reports Failure with message and returns") {
+      [&] {
+        RC_FAIL_RETURN("foo bar baz");
+        returned = false;
+      }();
+      REQUIRE(returned);
+      REQUIRE(context.results.size() == 1);
+      const auto &result = context.results.front();
+      REQUIRE(result.type == CaseResult::Type::Failure);
+      REQUIRE(descriptionContains(result, "RC_FAIL_RETURN(\"foo bar baz\")"));
+    }
+  }
+
+  SECTION("RC_PRE_RETURN") {
+    SECTION("does nothing if expression is true") {
+      [&] {
+        RC_PRE_RETURN(100 == 100);
+        returned = false;
+      }();
+      REQUIRE(!returned);
+      REQUIRE(context.results.empty());
+    }
+
+    SECTION("when false, reports Discard with relevant info and returns") {
+      [&] {
+        RC_PRE_RETURN(x++ == 100);
+        returned = false;
+      }();
+      REQUIRE(returned);
+      REQUIRE(context.results.size() == 1);
+      const auto &result = context.results.front();
+      REQUIRE(result.type == CaseResult::Type::Discard);
+      REQUIRE(descriptionContains(result, "0 == 100"));
+      REQUIRE(descriptionContains(result, "RC_PRE_RETURN(x++ == 100)"));
+    }
+  }
+
+  SECTION("RC_DISCARD_RETURN") {
+    SECTION("reports Discard with message and returns") {
+      [&] {
+        RC_DISCARD_RETURN("foo bar baz");
+        returned = false;
+      }();
+      REQUIRE(returned);
+      REQUIRE(context.results.size() == 1);
+      const auto &result = context.results.front();
+      REQUIRE(result.type == CaseResult::Type::Discard);
+      REQUIRE(
+          descriptionContains(result, "RC_DISCARD_RETURN(\"foo bar baz\")"));
+    }
+  }
+
+  SECTION("throws if the current context does not handle the result") {
+    ImplicitParam<param::CurrentPropertyContext> letDefault(
+        param::CurrentPropertyContext::defaultValue());
+    try {
+      [] { RC_PRE_RETURN(false); }();
+      FAIL("Never threw");
+    } catch (const CaseResult &result) {
+      REQUIRE(result.type == CaseResult::Type::Discard);
+    }
+  }
+
+  SECTION("results are reported to the property") {
+    const auto discarding = toProperty([] {
+      RC_PRE_RETURN(false);
+      RC_FAIL("Did not return");
+    });
+    REQUIRE(discarding(Random(), 0).value().result.type ==
+            CaseResult::Type::Discard);
+
+    const auto failing = toProperty([] { RC_ASSERT_RETURN(false); });
+    REQUIRE(failing(Random(), 0).value().result.type ==
+            CaseResult::Type::Failure);
+  }
+}
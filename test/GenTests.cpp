@@ -114,6 +114,7 @@ TEST_CASE("Gen") {
     }
 
     SECTION("returns what is returned by onGenerate") { RC_ASSERT(x == 456); }
+
   }
 
   SECTION("as") {
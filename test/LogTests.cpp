@@ -31,5 +31,12 @@ TEST_CASE("RC_LOG") {
            RC_LOG(str);
            RC_ASSERT(context.stream.str() == (str + "\n"));
          });
+
+    SECTION("works with string literals") {
+      LogPropertyContext context;
+      ImplicitParam<param::CurrentPropertyContext> letContext(&context);
+      RC_LOG("foobar");
+      REQUIRE(context.stream.str() == "foobar\n");
+    }
   }
 }
@@ -36,6 +36,28 @@ struct AssociativeProperties {
                        });
   }
 };
+
+Gen<Random> fastRandom() {
+  return gen::map(
+      gen::tuple(gen::arbitrary<uint64_t>(),
+                 gen::arbitrary<std::vector<bool>>(),
+                 gen::inRange<int>(0, 1000)),
+      [](const std::tuple<uint64_t, std::vector<bool>, int> &t) {
+        Random random(std::get<0>(t), Random::Engine::Fast);
+        for (bool x : std::get<1>(t)) {
+          if (!x) {
+            random.split();
+          } else {
+            random = random.split();
+          }
+        }
+
+        for (int i = 0; i < std::get<2>(t); i++) {
+          random.next();
+        }
+        return random;
+      });
+}
 }
 
 TEST_CASE("Random") {
@@ -184,4 +206,102 @@ TEST_CASE("Random") {
   SECTION("serialization") {
     SerializationProperties::exec<Random>(trulyArbitraryRandom());
   }
+
+  SECTION("fill") {
+    const auto randoms =
+        gen::oneOf(trulyArbitraryRandom(), fastRandom());
+
+    prop("yields the same numbers as calling next",
+         [=] {
+           Random r1 = *randoms;
+           Random r2(r1);
+           const auto n = *gen::inRange<std::size_t>(0, 100);
+           std::vector<Random::Number> expected;
+           for (std::size_t i = 0; i < n; i++) {
+             expected.push_back(r1.next());
+           }
+
+           std::vector<Random::Number> actual(n);
+           r2.fill(actual.data(), n);
+           RC_ASSERT(actual == expected);
+           RC_ASSERT(r1 == r2);
+         });
+  }
+
+  SECTION("fast engine") {
+    prop("engine returns the engine",
+         [](uint64_t seed) {
+           RC_ASSERT(Random(seed).engine() == Random::Engine::Default);
+           RC_ASSERT(Random(seed, Random::Engine::Fast).engine() ==
+                     Random::Engine::Fast);
+         });
+
+    prop("yields a different sequence than the default engine",
+         [](uint64_t seed) {
+           Random r1(seed);
+           Random r2(seed, Random::Engine::Fast);
+           RC_ASSERT(r1 != r2);
+           for (std::size_t i = 0; i < 4; i++) {
+             RC_SUCCEED_IF(r1.next() != r2.next());
+           }
+           RC_FAIL("Equal random numbers");
+         });
+
+    prop("different seeds yield different sequences",
+         [] {
+           auto seed1 = *gen::arbitrary<uint64_t>();
+           auto seed2 = *gen::distinctFrom(seed1);
+           Random r1(seed1, Random::Engine::Fast);
+           Random r2(seed2, Random::Engine::Fast);
+           RC_SUCCEED_IF(r1.next() != r2.next());
+           RC_FAIL("Equal random numbers");
+         });
+
+    prop("different splits yield different sequences",
+         [] {
+           Random r1 = *fastRandom();
+           Random r2(r1.split());
+           RC_ASSERT(r1 != r2);
+           RC_SUCCEED_IF(r1.next() != r2.next());
+           RC_FAIL("Equal random numbers");
+         });
+
+    prop("copies yield equal random numbers",
+         [] {
+           Random r1 = *fastRandom();
+           Random r2(r1);
+           for (std::size_t i = 0; i < 1000; i++) {
+             auto x1 = r1.next();
+             RC_ASSERT(x1 == r2.next());
+           }
+         });
+
+    prop("has uniform distribution",
+         [] {
+           Random random = *fastRandom();
+           std::array<std::uint64_t, 16> bins;
+           static constexpr std::uint64_t kBinSize =
+               (std::numeric_limits<std::uint64_t>::max() / 16) + 1;
+           bins.fill(0);
+           static constexpr std::size_t nSamples = 200000;
+           for (std::size_t i = 0; i < nSamples; i++) {
+             const auto bin =
+                 static_cast<std::size_t>(random.next() / kBinSize);
+             bins[bin]++;
+           }
+
+           double ideal = nSamples / static_cast<double>(bins.size());
+           double error = 0.0;
+           for (const auto x : bins) {
+             double diff = 1.0 - (x / ideal);
+             error += diff * diff;
+           }
+
+           RC_ASSERT(error < 0.01);
+         });
+
+    SECTION("serialization") {
+      SerializationProperties::exec<Random>(fastRandom());
+    }
+  }
 }
@@ -121,6 +121,28 @@ TEST_CASE("Seq") {
     REQUIRE(value->second == expectedLog);
   }
 
+  SECTION("small implementation objects are not allocated on the heap") {
+    // Allocations are only counted while pooling is enabled
+    rc::detail::ImplPoolScope poolScope(true);
+    const auto numAllocations = rc::detail::ImplPool::numAllocations();
+    int x = 0;
+    Seq<int> seq([x]() mutable -> Maybe<int> {
+      if (x == 3) {
+        return Nothing;
+      }
+      return x++;
+    });
+    auto copy = seq;
+    auto moved = std::move(copy);
+    copy = moved;
+    REQUIRE(rc::detail::ImplPool::numAllocations() == numAllocations);
+
+    REQUIRE(*seq.next() == 0);
+    REQUIRE(*moved.next() == 0);
+    REQUIRE(*moved.next() == 1);
+    REQUIRE(*copy.next() == 0);
+  }
+
   SECTION("if exception is throw on next(), Seq ends immediately") {
     auto x = 0;
     const auto seq = Seq<int>([x]() mutable -> Maybe<int> {
@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 
+#include <array>
+
 #include "rapidcheck/detail/Any.h"
 
 #include "util/Util.h"
@@ -60,6 +62,9 @@ void show(const InitTracker<T> &value, std::ostream &os) {
 
 using StringTracker = InitTracker<std::string>;
 
+// Too large to be stored inline
+using LargeValue = std::array<std::string, 8>;
+
 } // namespace
 
 TEST_CASE("Any") {
@@ -147,6 +152,49 @@ TEST_CASE("Any") {
     }
   }
 
+  SECTION("hashValue") {
+    SECTION("gives equal values equal hashes") {
+      std::size_t a, b;
+      REQUIRE(Any::of(std::string("foo")).hashValue(a));
+      REQUIRE(Any::of(std::string("foo")).hashValue(b));
+      REQUIRE(a == b);
+    }
+
+    SECTION("supports containers of hashable values") {
+      std::size_t hash;
+      REQUIRE(Any::of(std::vector<std::pair<int, double>>{{1, 2.0}})
+                  .hashValue(hash));
+    }
+
+    SECTION("returns false for values that cannot be hashed") {
+      std::size_t hash;
+      REQUIRE(!Any::of(InitTracker<int>(1337)).hashValue(hash));
+      REQUIRE(!Any().hashValue(hash));
+    }
+  }
+
+  SECTION("equalValue") {
+    SECTION("returns true for equal values") {
+      REQUIRE(Any::of(std::vector<int>{1, 2, 3})
+                  .equalValue(Any::of(std::vector<int>{1, 2, 3})));
+    }
+
+    SECTION("returns false for different values that print the same") {
+      REQUIRE(!Any::of(1.0).equalValue(Any::of(1.0 + 1e-9)));
+      REQUIRE(!Any::of(0.0).equalValue(Any::of(-0.0)));
+    }
+
+    SECTION("returns false for values of different types") {
+      REQUIRE(!Any::of(1).equalValue(Any::of(1L)));
+    }
+
+    SECTION("returns false for values that cannot be hashed") {
+      REQUIRE(!Any::of(InitTracker<int>(1337))
+                   .equalValue(Any::of(InitTracker<int>(1337))));
+      REQUIRE(!Any().equalValue(Any()));
+    }
+  }
+
   SECTION("operator bool()") {
     SECTION("returns false for null Any") {
       Any any;
@@ -159,20 +207,31 @@ TEST_CASE("Any") {
     }
   }
 
+  SECTION("stores small values inline") {
+    Any any = Any::of(1337);
+    const auto addr = reinterpret_cast<const char *>(&any.get<int>());
+    const auto begin = reinterpret_cast<const char *>(&any);
+    REQUIRE(addr >= begin);
+    REQUIRE(addr < (begin + sizeof(Any)));
+  }
+
   SECTION("move constructor") {
     SECTION("if not null") {
       std::string str("foobar");
       Any from = Any::of(str);
-      auto addr = &from.get<std::string>();
       Any to(std::move(from));
 
       SECTION("value is equal to original") {
         REQUIRE(to.get<std::string>() == str);
       }
       SECTION("original is reset") { REQUIRE(!from); }
-      SECTION("addr is the same as original") {
-        REQUIRE(&to.get<std::string>() == addr);
-      }
+    }
+
+    SECTION("if stored on the heap, addr is the same as original") {
+      Any from = Any::of(LargeValue());
+      auto addr = &from.get<LargeValue>();
+      Any to(std::move(from));
+      REQUIRE(&to.get<LargeValue>() == addr);
     }
 
     SECTION("if from is null, to is also null") {
@@ -186,7 +245,6 @@ TEST_CASE("Any") {
     SECTION("if not null") {
       std::string str("foobar");
       Any from = Any::of(str);
-      auto addr = &from.get<std::string>();
       Any to;
       to = std::move(from);
 
@@ -194,9 +252,14 @@ TEST_CASE("Any") {
         REQUIRE(to.get<std::string>() == str);
       }
       SECTION("original is reset") { REQUIRE(!from); }
-      SECTION("addr is the same as original") {
-        REQUIRE(&to.get<std::string>() == addr);
-      }
+    }
+
+    SECTION("if stored on the heap, addr is the same as original") {
+      Any from = Any::of(LargeValue());
+      auto addr = &from.get<LargeValue>();
+      Any to;
+      to = std::move(from);
+      REQUIRE(&to.get<LargeValue>() == addr);
     }
 
     SECTION("if from is null, to is also null") {
@@ -198,6 +198,32 @@ TEST_CASE("BitStream") {
          });
   }
 
+  SECTION("fillBytes") {
+    prop("yields the same bytes as taking one byte at a time",
+         [] {
+           const auto engine = *gen::element(Random::Engine::Default,
+                                             Random::Engine::Fast);
+           const Random random(*gen::arbitrary<uint64_t>(), engine);
+           auto stream1 = bitStreamOf(random);
+           auto stream2 = bitStreamOf(random);
+           // Leave some bits buffered now and then
+           const auto skip = *gen::inRange(0, 8);
+           stream1.next<uint8_t>(skip);
+           stream2.next<uint8_t>(skip);
+
+           const auto n = *gen::inRange<std::size_t>(0, 500);
+           std::vector<uint8_t> expected;
+           for (std::size_t i = 0; i < n; i++) {
+             expected.push_back(stream1.next<uint8_t>());
+           }
+
+           std::vector<uint8_t> actual(n);
+           stream2.fillBytes(actual.data(), n);
+           RC_ASSERT(actual == expected);
+           RC_ASSERT(stream1.next<uint64_t>() == stream2.next<uint64_t>());
+         });
+  }
+
   SECTION("bitStreamOf") {
     SECTION("copies source if const") {
       auto source = makeSource(seq::just(0, 1));
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+
+#include <sstream>
+
+#include "rapidcheck/detail/CommandStats.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+namespace {
+
+struct SomeCommand {};
+
+} // namespace
+
+TEST_CASE("CommandStatsRecorder") {
+  SECTION("CommandStatsScope sets and restores the current recorder") {
+    CommandStatsRecorder recorder1;
+    CommandStatsRecorder recorder2;
+    CommandStatsScope scope1(&recorder1);
+    {
+      CommandStatsScope scope2(&recorder2);
+      REQUIRE(CommandStatsRecorder::current() == &recorder2);
+      {
+        CommandStatsScope scope3(nullptr);
+        REQUIRE(CommandStatsRecorder::current() == nullptr);
+      }
+      REQUIRE(CommandStatsRecorder::current() == &recorder2);
+    }
+    REQUIRE(CommandStatsRecorder::current() == &recorder1);
+  }
+
+  SECTION("groups runs by name sorted by name") {
+    CommandStatsRecorder recorder;
+    recorder.record("b", 1);
+    recorder.record("a", 2);
+    recorder.record("b", 3);
+
+    const auto stats = recorder.stats();
+    REQUIRE(stats.size() == 2U);
+    REQUIRE(stats[0].name == "a");
+    REQUIRE(stats[0].latencies.count() == 1U);
+    REQUIRE(stats[1].name == "b");
+    REQUIRE(stats[1].latencies.count() == 2U);
+    REQUIRE(stats[1].latencies.max() == 3U);
+  }
+
+#ifndef RC_DONT_USE_RTTI
+  SECTION("names runs recorded by type after the demangled type") {
+    CommandStatsRecorder recorder;
+    recorder.record(typeid(SomeCommand), 1);
+    recorder.record(typeid(SomeCommand), 2);
+
+    const auto stats = recorder.stats();
+    REQUIRE(stats.size() == 1U);
+    REQUIRE(stats[0].name.find("SomeCommand") != std::string::npos);
+    REQUIRE(stats[0].latencies.count() == 2U);
+  }
+#endif // RC_DONT_USE_RTTI
+}
+
+TEST_CASE("printCommandStats") {
+  CommandStatsRecorder recorder;
+  recorder.record("Insert", 1500);
+  recorder.record("Insert", 2500);
+  recorder.record("Lookup", 40);
+
+  std::ostringstream os;
+  printCommandStats(recorder.stats(), os);
+  std::istringstream lines(os.str());
+  std::string header;
+  std::string insert;
+  std::string lookup;
+  std::getline(lines, header);
+  std::getline(lines, insert);
+  std::getline(lines, lookup);
+
+  REQUIRE(header.find("count") != std::string::npos);
+  REQUIRE(insert.find("Insert") == 0);
+  REQUIRE(insert.find(" 2 ") != std::string::npos);
+  REQUIRE(insert.find("2.0us") != std::string::npos);
+  REQUIRE(lookup.find("Lookup") == 0);
+  REQUIRE(lookup.find("40ns") != std::string::npos);
+}
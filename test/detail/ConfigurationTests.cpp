@@ -15,6 +15,7 @@ TEST_CASE("Configuration") {
     PROP_REPLACE_MEMBER_INEQUAL(Configuration, testParams);
     PROP_REPLACE_MEMBER_INEQUAL(Configuration, verboseProgress);
     PROP_REPLACE_MEMBER_INEQUAL(Configuration, verboseShrinking);
+    PROP_REPLACE_MEMBER_INEQUAL(Configuration, exampleDatabase);
   }
 
   SECTION("operator<<") { propConformsToOutputOperator<Configuration>(); }
@@ -56,12 +57,78 @@ TEST_CASE("configFromString") {
                       ConfigurationException);
   }
 
+  SECTION("throws on invalid maxTime") {
+    REQUIRE_THROWS_AS(configFromString("max_time=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("max_time=-2"), ConfigurationException);
+  }
+
+  SECTION("throws on invalid maxShrinkTime") {
+    REQUIRE_THROWS_AS(configFromString("max_shrink_time=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("max_shrink_time=-2"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid maxShrinkSteps") {
+    REQUIRE_THROWS_AS(configFromString("max_shrink_steps=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("max_shrink_steps=-2"),
+                      ConfigurationException);
+  }
+
   SECTION("throws on invalid noshrink setting") {
     REQUIRE_THROWS_AS(configFromString("noshrink=foobar"),
                       ConfigurationException);
     REQUIRE_THROWS_AS(configFromString("noshrink=2"), ConfigurationException);
   }
 
+  SECTION("throws on invalid threads setting") {
+    REQUIRE_THROWS_AS(configFromString("threads=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("threads=0"), ConfigurationException);
+  }
+
+  SECTION("throws on invalid shrink threads setting") {
+    REQUIRE_THROWS_AS(configFromString("shrink_threads=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("shrink_threads=0"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid shrink cache setting") {
+    REQUIRE_THROWS_AS(configFromString("shrink_cache=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("shrink_cache=2"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid pool allocation setting") {
+    REQUIRE_THROWS_AS(configFromString("pool_allocation=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("pool_allocation=2"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid command stats setting") {
+    REQUIRE_THROWS_AS(configFromString("command_stats=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("command_stats=2"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid engine setting") {
+    REQUIRE_THROWS_AS(configFromString("engine=foobar"),
+                      ConfigurationException);
+  }
+
+  SECTION("throws on invalid ddmin threshold setting") {
+    REQUIRE_THROWS_AS(configFromString("ddmin_threshold=foobar"),
+                      ConfigurationException);
+    REQUIRE_THROWS_AS(configFromString("ddmin_threshold=-1"),
+                      ConfigurationException);
+  }
+
   SECTION("throws on invalid verbose progress setting") {
     REQUIRE_THROWS_AS(configFromString("verbose_progress=foo"),
                       ConfigurationException);
@@ -0,0 +1,40 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include "detail/DistributionCounter.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+TEST_CASE("DistributionCounter") {
+  SECTION("is empty initially") {
+    DistributionCounter counter;
+    REQUIRE(counter.empty());
+    REQUIRE(counter.distribution().empty());
+  }
+
+  prop("counts each combination of tags",
+       [](const std::vector<Tags> &allTags) {
+         DistributionCounter counter;
+         Distribution expected;
+         for (const auto &tags : allTags) {
+           counter.add(tags);
+           expected[tags]++;
+         }
+
+         RC_ASSERT(counter.empty() == allTags.empty());
+         RC_ASSERT(counter.distribution() == expected);
+       });
+
+  SECTION("distinguishes combinations by the order of tags") {
+    DistributionCounter counter;
+    counter.add({"a", "b"});
+    counter.add({"b", "a"});
+    counter.add({"a", "b"});
+
+    Distribution expected;
+    expected[{"a", "b"}] = 2;
+    expected[{"b", "a"}] = 1;
+    REQUIRE(counter.distribution() == expected);
+  }
+}
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include "detail/ExampleDatabase.h"
+
+#include "util/Generators.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+namespace {
+
+std::string tempDirectoryName() {
+  static int counter = 0;
+  return "rc_example_db_" + std::to_string(counter++);
+}
+
+} // namespace
+
+TEST_CASE("ExampleDatabase") {
+  prop("load returns what was stored",
+       [](const std::string &id) {
+         const auto directory = tempDirectoryName();
+         ExampleDatabase database(directory);
+         const auto entries = *gen::nonEmpty<std::vector<Reproduce>>();
+         database.store(id, entries);
+         RC_ASSERT(database.load(id) == entries);
+
+         database.store(id, {});
+         RC_ASSERT(database.load(id).empty());
+         std::remove(directory.c_str());
+       });
+
+  prop("load returns nothing for unknown IDs",
+       [](const std::string &id) {
+         ExampleDatabase database(tempDirectoryName());
+         RC_ASSERT(database.load(id).empty());
+       });
+
+  prop("add does not add duplicates",
+       [](const std::string &id, const Reproduce &reproduce) {
+         const auto directory = tempDirectoryName();
+         ExampleDatabase database(directory);
+         database.add(id, reproduce);
+         database.add(id, reproduce);
+         RC_ASSERT(database.load(id) == std::vector<Reproduce>{reproduce});
+
+         database.store(id, {});
+         std::remove(directory.c_str());
+       });
+
+  prop("different IDs use different files",
+       [](const std::string &id1) {
+         const auto id2 = *gen::distinctFrom(id1);
+         ExampleDatabase database("dir");
+         RC_ASSERT(database.pathFor(id1) != database.pathFor(id2));
+       });
+
+  SECTION("file names of long IDs are not too long") {
+    ExampleDatabase database("dir");
+    const auto path = database.pathFor(std::string(1000, 'x'));
+    REQUIRE(path.size() < 200);
+  }
+
+  SECTION("ignores lines that cannot be parsed") {
+    const auto directory = tempDirectoryName();
+    ExampleDatabase database(directory);
+    Reproduce reproduce;
+    reproduce.size = 10;
+    reproduce.shrinkPath = {1, 2, 3};
+    database.add("foo", reproduce);
+    {
+      std::ofstream out(database.pathFor("foo"), std::ios::app);
+      out << "this is not valid" << std::endl;
+    }
+
+    REQUIRE(database.load("foo") == std::vector<Reproduce>{reproduce});
+    database.store("foo", {});
+    std::remove(directory.c_str());
+  }
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <thread>
+#include <vector>
+
+#include "rapidcheck/detail/ImplPool.h"
+
+#include "util/ArbitraryRandom.h"
+#include "util/ShrinkableUtils.h"
+
+using namespace rc;
+using namespace rc::detail;
+using namespace rc::test;
+
+namespace {
+
+// Takes all the free memory of the given size out of the pool of the current
+// thread so that the next allocation has to come from the global allocator
+std::vector<void *> drainPool(std::size_t size) {
+  std::vector<void *> blocks;
+  const auto numAllocations = ImplPool::numAllocations();
+  while (ImplPool::numAllocations() == numAllocations) {
+    blocks.push_back(ImplPool::allocate(size));
+  }
+  return blocks;
+}
+
+void releaseAll(const std::vector<void *> &blocks, std::size_t size) {
+  for (const auto block : blocks) {
+    ImplPool::deallocate(block, size);
+  }
+}
+
+} // namespace
+
+TEST_CASE("ImplPool") {
+  SECTION("reuses released memory when enabled") {
+    ImplPoolScope scope(true);
+    const auto p1 = ImplPool::allocate(40);
+    ImplPool::deallocate(p1, 40);
+    const auto numAllocations = ImplPool::numAllocations();
+    const auto p2 = ImplPool::allocate(40);
+    REQUIRE(p2 == p1);
+    REQUIRE(ImplPool::numAllocations() == numAllocations);
+    ImplPool::deallocate(p2, 40);
+  }
+
+  SECTION("does not keep memory released while disabled") {
+    ImplPoolScope scope(true);
+    const auto blocks = drainPool(48);
+    {
+      ImplPoolScope disabledScope(false);
+      ImplPool::deallocate(ImplPool::allocate(48), 48);
+    }
+    const auto numAllocations = ImplPool::numAllocations();
+    const auto p = ImplPool::allocate(48);
+    REQUIRE(ImplPool::numAllocations() == (numAllocations + 1));
+    ImplPool::deallocate(p, 48);
+    releaseAll(blocks, 48);
+  }
+
+  SECTION("does not reuse memory for objects of a different size") {
+    ImplPoolScope scope(true);
+    const auto blocks = drainPool(64);
+    ImplPool::deallocate(ImplPool::allocate(56), 56);
+    const auto numAllocations = ImplPool::numAllocations();
+    const auto p = ImplPool::allocate(64);
+    REQUIRE(ImplPool::numAllocations() == (numAllocations + 1));
+    ImplPool::deallocate(p, 64);
+    releaseAll(blocks, 64);
+  }
+
+  SECTION("memory allocated while disabled can be pooled") {
+    const auto p = ImplPool::allocate(40);
+    ImplPoolScope scope(true);
+    ImplPool::deallocate(p, 40);
+    const auto numAllocations = ImplPool::numAllocations();
+    REQUIRE(ImplPool::allocate(40) == p);
+    REQUIRE(ImplPool::numAllocations() == numAllocations);
+    ImplPool::deallocate(p, 40);
+  }
+
+  SECTION("memory can be released on another thread") {
+    ImplPoolScope scope(true);
+    const auto p = ImplPool::allocate(40);
+    std::thread([=] {
+      ImplPoolScope threadScope(true);
+      ImplPool::deallocate(p, 40);
+    }).join();
+  }
+
+  SECTION("scopes restore the previous state") {
+    ImplPoolScope scope1(true);
+    {
+      ImplPoolScope scope2(false);
+      REQUIRE(!ImplPool::isEnabled());
+    }
+    REQUIRE(ImplPool::isEnabled());
+  }
+
+  prop("pooled shrinkables are equivalent to ordinary ones",
+       [] {
+         const auto random = *gen::arbitrary<Random>();
+         const auto size = *gen::inRange(0, 100);
+         const auto gen = gen::arbitrary<std::vector<std::string>>();
+         const auto expected = gen(random, size);
+         ImplPoolScope scope(true);
+         assertEquivalent(gen(random, size), expected);
+       });
+}
@@ -3,6 +3,7 @@
 #include <rapidcheck/state.h>
 
 #include <stack>
+#include <thread>
 
 using namespace rc;
 using namespace rc::detail;
@@ -264,5 +265,22 @@ TEST_CASE("ImplicitParam") {
       REQUIRE(ImplicitParam<ParamA>::value() == "foobar");
       REQUIRE(ImplicitParam<ParamB>::value() == 123);
     }
+
+    SECTION("bindings are not shared between threads") {
+      std::string valueA;
+      int valueB = 0;
+      std::thread thread([&] {
+        valueA = ImplicitParam<ParamA>::value();
+        ImplicitParam<ParamB> b2(456);
+        valueB = ImplicitParam<ParamB>::value();
+        ImplicitParam<ParamA>::value() = "other thread";
+      });
+      thread.join();
+
+      REQUIRE(valueA == ParamA::defaultValue());
+      REQUIRE(valueB == 456);
+      REQUIRE(ImplicitParam<ParamA>::value() == "foobar");
+      REQUIRE(ImplicitParam<ParamB>::value() == 123);
+    }
   }
 }
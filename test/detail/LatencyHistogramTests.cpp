@@ -0,0 +1,85 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "rapidcheck/detail/LatencyHistogram.h"
+
+using namespace rc;
+using namespace rc::detail;
+
+TEST_CASE("LatencyHistogram") {
+  SECTION("is empty by default") {
+    LatencyHistogram histogram;
+    REQUIRE(histogram.count() == 0U);
+    REQUIRE(histogram.min() == 0U);
+    REQUIRE(histogram.max() == 0U);
+    REQUIRE(histogram.mean() == 0.0);
+    REQUIRE(histogram.percentile(50) == 0U);
+  }
+
+  prop("count, min, max and mean are exact",
+       [](const std::vector<std::uint32_t> &values) {
+         RC_PRE(!values.empty());
+         LatencyHistogram histogram;
+         double sum = 0.0;
+         for (const auto value : values) {
+           histogram.record(value);
+           sum += value;
+         }
+
+         RC_ASSERT(histogram.count() == values.size());
+         RC_ASSERT(histogram.min() ==
+                   *std::min_element(begin(values), end(values)));
+         RC_ASSERT(histogram.max() ==
+                   *std::max_element(begin(values), end(values)));
+         const auto mean = sum / values.size();
+         RC_ASSERT(std::abs(histogram.mean() - mean) <= (mean * 1e-9));
+       });
+
+  prop("percentiles are at most about 3% above the exact value",
+       [](std::vector<std::uint64_t> values) {
+         RC_PRE(!values.empty());
+         LatencyHistogram histogram;
+         for (const auto value : values) {
+           histogram.record(value);
+         }
+
+         std::sort(begin(values), end(values));
+         const auto percent = *gen::inRange(0, 101);
+         const auto rank = std::max<std::size_t>(
+             static_cast<std::size_t>(
+                 std::ceil((percent / 100.0) * values.size())),
+             1);
+         const auto exact = values[rank - 1];
+         const auto actual = histogram.percentile(percent);
+         RC_ASSERT(actual >= exact);
+         RC_ASSERT((actual - exact) <= (exact / 32));
+       });
+
+  prop("merging is equivalent to recording all values in one histogram",
+       [](const std::vector<std::uint64_t> &values1,
+          const std::vector<std::uint64_t> &values2) {
+         LatencyHistogram histogram1;
+         LatencyHistogram expected;
+         for (const auto value : values1) {
+           histogram1.record(value);
+           expected.record(value);
+         }
+         LatencyHistogram histogram2;
+         for (const auto value : values2) {
+           histogram2.record(value);
+           expected.record(value);
+         }
+
+         histogram1.merge(histogram2);
+         RC_ASSERT(histogram1.count() == expected.count());
+         RC_ASSERT(histogram1.min() == expected.min());
+         RC_ASSERT(histogram1.max() == expected.max());
+         for (int percent = 0; percent <= 100; percent += 10) {
+           RC_ASSERT(histogram1.percentile(percent) ==
+                     expected.percentile(percent));
+         }
+       });
+}
@@ -53,6 +53,11 @@ TEST_CASE("LogTestListener") {
       listener.onShrinkTried(desc, false);
       REQUIRE(os.str().empty());
     }
+
+    SECTION("prints nothing when onShrinkCacheStats is called") {
+      listener.onShrinkCacheStats(3, 4);
+      REQUIRE(os.str().empty());
+    }
   }
 
   SECTION("when verbose shrinking is on") {
@@ -67,6 +72,26 @@ TEST_CASE("LogTestListener") {
       listener.onShrinkTried(desc, true);
       REQUIRE(os.str() == "!");
     }
+
+    SECTION("prints the cache hits and misses") {
+      listener.onShrinkCacheStats(3, 4);
+      REQUIRE(os.str().find("3 hits, 4 misses") != std::string::npos);
+    }
+  }
+
+  SECTION("prints command stats regardless of verbosity") {
+    LogTestListener listener(os, false, false);
+    std::vector<CommandStats> stats(1);
+    stats[0].name = "SomeCommand";
+    stats[0].latencies.record(1000);
+    listener.onCommandStats(stats);
+    REQUIRE(os.str().find("SomeCommand") != std::string::npos);
+  }
+
+  SECTION("prints nothing when there are no command stats") {
+    LogTestListener listener(os, false, false);
+    listener.onCommandStats(std::vector<CommandStats>());
+    REQUIRE(os.str().empty());
   }
 
   SECTION("when both verbose shrinking and verbose progress is off") {
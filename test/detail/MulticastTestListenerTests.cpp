@@ -71,6 +71,32 @@ TEST_CASE("MulticastTestListener") {
          });
   }
 
+  SECTION("onShrinkCacheStats") {
+    prop("passes on correct arguments", [](int numHits, int numMisses) {
+      MockTestListener mock;
+      mock.onShrinkCacheStatsCallback = [=](int hits, int misses) {
+        RC_ASSERT(hits == numHits);
+        RC_ASSERT(misses == numMisses);
+      };
+      auto listener = makeUnicast(mock);
+      listener.onShrinkCacheStats(numHits, numMisses);
+    });
+  }
+
+  SECTION("onCommandStats") {
+    prop("passes on correct arguments", [](const std::string &name) {
+      std::vector<CommandStats> stats(1);
+      stats[0].name = name;
+      MockTestListener mock;
+      mock.onCommandStatsCallback = [=](const std::vector<CommandStats> &s) {
+        RC_ASSERT(s.size() == 1U);
+        RC_ASSERT(s[0].name == name);
+      };
+      auto listener = makeUnicast(mock);
+      listener.onCommandStats(stats);
+    });
+  }
+
   SECTION("onTestFinished") {
     prop("passes on correct arguments",
          [](const TestMetadata &metadata, const TestResult &result) {
@@ -138,6 +138,29 @@ TEST_CASE("PropertyAdapter") {
          }
        });
 
+  prop("keeps the order of messages logged through the stream and directly",
+       [](const std::vector<std::string> &messages) {
+         std::string expected;
+         for (std::size_t i = 0; i < messages.size(); i++) {
+           expected += messages[i];
+           if ((i % 2) != 0) {
+             expected += "\n";
+           }
+         }
+         RC_PRE(!expected.empty());
+
+         const auto result = makeAdapter([=] {
+           for (std::size_t i = 0; i < messages.size(); i++) {
+             if ((i % 2) == 0) {
+               RC_LOG() << messages[i];
+             } else {
+               RC_LOG(messages[i]);
+             }
+           }
+         })();
+         RC_ASSERT(descriptionContains(result, "Log:\n" + expected));
+       });
+
   SECTION("does not include log when nothing was logged") {
     const auto result = makeAdapter([=] {})();
     REQUIRE(!descriptionContains(result, "Log:"));
@@ -83,6 +83,8 @@ TEST_CASE("FailureResult") {
     PROP_REPLACE_MEMBER_INEQUAL(FailureResult, description);
     PROP_REPLACE_MEMBER_INEQUAL(FailureResult, reproduce);
     PROP_REPLACE_MEMBER_INEQUAL(FailureResult, counterExample);
+    PROP_REPLACE_MEMBER_INEQUAL(FailureResult, numWastedShrinks);
+    PROP_REPLACE_MEMBER_INEQUAL(FailureResult, partiallyShrunk);
   }
 
   SECTION("operator<<") { propConformsToOutputOperator<FailureResult>(); }
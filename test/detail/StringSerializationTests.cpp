@@ -15,3 +15,11 @@ TEST_CASE("stringToReproduceMap") {
                    reproMap);
        });
 }
+
+TEST_CASE("stringToReproduce") {
+  prop("deserializes what reproduceToString serialized",
+       [](const Reproduce &reproduce) {
+         RC_ASSERT(stringToReproduce(reproduceToString(reproduce)) ==
+                   reproduce);
+       });
+}
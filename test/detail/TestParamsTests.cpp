@@ -16,4 +16,14 @@ TEST_CASE("TestParams") {
   PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxSuccess);
   PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxSize);
   PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxDiscardRatio);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, numThreads);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, numShrinkThreads);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxTime);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxShrinkTime);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, maxShrinkSteps);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, cacheShrinks);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, poolAllocation);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, commandStats);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, ddminThreshold);
+  PROP_REPLACE_MEMBER_INEQUAL(TestParams, engine);
 }
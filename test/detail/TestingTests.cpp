@@ -2,6 +2,7 @@
 #include <rapidcheck/catch.h>
 
 #include <algorithm>
+#include <cstdio>
 
 #include "rapidcheck/detail/TestListenerAdapter.h"
 #include "detail/Testing.h"
@@ -160,7 +161,7 @@ TEST_CASE("searchProperty") {
   prop("does not include empty tags in tags",
        [](const TestParams &params) {
          const auto result = searchTestable([] {}, params);
-         RC_ASSERT(result.tags.empty());
+         RC_ASSERT(result.distribution.empty());
        });
 
   prop("does not include tags for discarded tests in tags",
@@ -169,7 +170,7 @@ TEST_CASE("searchProperty") {
            RC_TAG(0);
            RC_DISCARD("");
          }, params);
-         RC_ASSERT(result.tags.empty());
+         RC_ASSERT(result.distribution.empty());
        });
 
   prop("does not include tags for failed tests in tags",
@@ -178,21 +179,25 @@ TEST_CASE("searchProperty") {
            RC_TAG(0);
            RC_FAIL("");
          }, params);
-         RC_ASSERT(result.tags.empty());
+         RC_ASSERT(result.distribution.empty());
        });
 
   prop("does not include empty tags in tags",
        [](const TestParams &params) {
-         const auto expected = *gen::container<std::vector<Tags>>(
-                                   params.maxSuccess, gen::nonEmpty<Tags>());
+         const auto allTags = *gen::container<std::vector<Tags>>(
+                                  params.maxSuccess, gen::nonEmpty<Tags>());
          std::size_t i = 0;
          const auto result = searchTestable([&] {
-           for (const auto &tag : expected[i++]) {
+           for (const auto &tag : allTags[i++]) {
              ImplicitParam<param::CurrentPropertyContext>::value()->addTag(tag);
            }
          }, params);
 
-         RC_ASSERT(result.tags == expected);
+         Distribution expected;
+         for (const auto &tags : allTags) {
+           expected[tags]++;
+         }
+         RC_ASSERT(result.distribution.distribution() == expected);
        });
 
   prop("does not include tags applied from generators",
@@ -205,7 +210,7 @@ TEST_CASE("searchProperty") {
            });
          }, params);
 
-         RC_ASSERT(result.tags.empty());
+         RC_ASSERT(result.distribution.empty());
        });
 
   prop("calls onTestCaseFinished for each successful test",
@@ -259,6 +264,83 @@ TEST_CASE("searchProperty") {
              property(result.failure->random, result.failure->size);
          RC_ASSERT(result.failure->shrinkable.value() == shrinkable.value());
        });
+
+  SECTION("stops searching when maxTime has passed") {
+    for (int numThreads = 1; numThreads <= 2; numThreads++) {
+      TestParams params;
+      params.maxSuccess = 1000000;
+      params.maxTime = 20;
+      params.numThreads = numThreads;
+      const auto result = searchTestable([] {}, params);
+      REQUIRE(result.type == SearchResult::Type::Success);
+      REQUIRE(result.numSuccess < params.maxSuccess);
+    }
+  }
+
+  prop("result does not depend on the number of threads",
+       [](TestParams params, int limit) {
+         const auto property = toProperty([=] {
+           const auto x = *gen::arbitrary<int>();
+           RC_TAG(x % 2, *genSize());
+           RC_PRE((x % 3) != 0);
+           RC_ASSERT(x >= limit);
+         });
+
+         params.numThreads = 1;
+         std::vector<CaseDescription> expectedDescriptions;
+         MockTestListener expectedListener;
+         expectedListener.onTestCaseFinishedCallback =
+             [&](const CaseDescription &desc) {
+               expectedDescriptions.push_back(desc);
+             };
+         const auto expected =
+             searchProperty(property, params, expectedListener);
+
+         params.numThreads = 4;
+         std::vector<CaseDescription> descriptions;
+         MockTestListener listener;
+         listener.onTestCaseFinishedCallback =
+             [&](const CaseDescription &desc) { descriptions.push_back(desc); };
+         const auto result = searchProperty(property, params, listener);
+
+         RC_ASSERT(result.type == expected.type);
+         RC_ASSERT(result.numSuccess == expected.numSuccess);
+         RC_ASSERT(result.numDiscarded == expected.numDiscarded);
+         RC_ASSERT(result.distribution.distribution() ==
+                   expected.distribution.distribution());
+         RC_ASSERT(descriptions.size() == expectedDescriptions.size());
+         for (std::size_t i = 0; i < descriptions.size(); i++) {
+           RC_ASSERT(descriptions[i].result == expectedDescriptions[i].result);
+           RC_ASSERT(descriptions[i].tags == expectedDescriptions[i].tags);
+         }
+         RC_ASSERT(static_cast<bool>(result.failure) ==
+                   static_cast<bool>(expected.failure));
+         if (result.failure) {
+           RC_ASSERT(result.failure->size == expected.failure->size);
+           RC_ASSERT(result.failure->random == expected.failure->random);
+         }
+       });
+
+  prop("with threads, finds the same failure as a serial search if no cases "
+       "are discarded",
+       [](TestParams params, int limit) {
+         const auto property = toProperty(
+             [=](int x) { RC_ASSERT(x >= limit); });
+
+         params.numThreads = 1;
+         const auto expected = searchProperty(property, params, dummyListener);
+         params.numThreads = *gen::inRange(2, 9);
+         const auto result = searchProperty(property, params, dummyListener);
+
+         RC_ASSERT(result.type == expected.type);
+         RC_ASSERT(result.numSuccess == expected.numSuccess);
+         RC_ASSERT(static_cast<bool>(result.failure) ==
+                   static_cast<bool>(expected.failure));
+         if (result.failure) {
+           RC_ASSERT(result.failure->size == expected.failure->size);
+           RC_ASSERT(result.failure->random == expected.failure->random);
+         }
+       });
 }
 
 namespace {
@@ -292,10 +374,10 @@ TEST_CASE("shrinkTestCase") {
                                return desc;
                              });
 
-         const auto result = shrinkTestCase(shrinkable, dummyListener);
-         RC_ASSERT(result.first.value().result.type ==
+         const auto result = shrinkTestCase(shrinkable, TestParams(), dummyListener);
+         RC_ASSERT(result.shrinkable.value().result.type ==
                    CaseResult::Type::Failure);
-         RC_ASSERT(result.first.value().result.description ==
+         RC_ASSERT(result.shrinkable.value().result.description ==
                    std::to_string(target));
        });
 
@@ -305,8 +387,8 @@ TEST_CASE("shrinkTestCase") {
                                            [](int x) { return (x % 2) == 0; });
          const auto shrinkable = countdownEven(start);
 
-         const auto result = shrinkTestCase(shrinkable, dummyListener);
-         RC_ASSERT(result.second.size() == std::size_t(start / 2));
+         const auto result = shrinkTestCase(shrinkable, TestParams(), dummyListener);
+         RC_ASSERT(result.path.size() == std::size_t(start / 2));
        });
 
   prop("walking the path gives the same result",
@@ -315,11 +397,11 @@ TEST_CASE("shrinkTestCase") {
                                            [](int x) { return (x % 2) == 0; });
          const auto shrinkable = countdownEven(start);
 
-         const auto shrinkResult = shrinkTestCase(shrinkable, dummyListener);
+         const auto shrinkResult = shrinkTestCase(shrinkable, TestParams(), dummyListener);
          const auto walkResult =
-             shrinkable::walkPath(shrinkable, shrinkResult.second);
+             shrinkable::walkPath(shrinkable, shrinkResult.path);
          RC_ASSERT(walkResult);
-         RC_ASSERT(shrinkResult.first.value() == walkResult->value());
+         RC_ASSERT(shrinkResult.shrinkable.value() == walkResult->value());
        });
 
   prop("calls onShrinkTried for each shrink tried",
@@ -336,8 +418,148 @@ TEST_CASE("shrinkTestCase") {
                RC_ASSERT(((x % 2) == 0) == accepted);
                acceptedBalance += accepted ? 1 : -1;
              };
-         const auto result = shrinkTestCase(shrinkable, listener);
+         const auto result = shrinkTestCase(shrinkable, TestParams(), listener);
+       });
+
+  prop("tries at most maxShrinkSteps shrinks",
+       [] {
+         const auto start = *gen::suchThat(gen::inRange<int>(0, 100),
+                                           [](int x) { return (x % 2) == 0; });
+         const auto shrinkable = countdownEven(start);
+         const auto full =
+             shrinkTestCase(shrinkable, TestParams(), dummyListener);
+
+         TestParams params;
+         params.maxShrinkSteps = *gen::inRange(1, 100);
+         params.numShrinkThreads = *gen::inRange(1, 4);
+         MockTestListener listener;
+         const auto result = shrinkTestCase(shrinkable, params, listener);
+
+         RC_ASSERT(listener.onShrinkTriedCount <= params.maxShrinkSteps);
+         if (result.partial) {
+           RC_ASSERT(listener.onShrinkTriedCount == params.maxShrinkSteps);
+           RC_ASSERT(std::equal(begin(result.path),
+                                end(result.path),
+                                begin(full.path)));
+         } else {
+           RC_ASSERT(result.path == full.path);
+         }
+       });
+
+  SECTION("stops shrinking when maxShrinkTime has passed") {
+    const auto shrinkable = shrinkable::shrinkRecur(
+        CaseDescription(),
+        [](const CaseDescription &desc) { return seq::repeat(desc); });
+
+    TestParams params;
+    params.maxShrinkTime = 20;
+    const auto result = shrinkTestCase(shrinkable, params, dummyListener);
+    REQUIRE(result.partial);
+  }
+
+  prop("with several shrink threads, yields the same result as serially",
+       [] {
+         const auto start = *gen::inRange<int>(0, 100);
+         const auto shrinkable =
+             shrinkable::map(shrinkable::shrinkRecur(
+                                 start,
+                                 [](int x) { return shrink::towards(x, 0); }),
+                             [=](int x) {
+                               CaseDescription desc;
+                               desc.result.type = ((x % 3) == 0)
+                                   ? CaseResult::Type::Failure
+                                   : CaseResult::Type::Success;
+                               desc.result.description = std::to_string(x);
+                               return desc;
+                             });
+
+         std::vector<std::pair<CaseDescription, bool>> expectedTries;
+         MockTestListener expectedListener;
+         expectedListener.onShrinkTriedCallback =
+             [&](const CaseDescription &desc, bool accepted) {
+               expectedTries.emplace_back(desc, accepted);
+             };
+         const auto expected =
+             shrinkTestCase(shrinkable, TestParams(), expectedListener);
+
+         TestParams params;
+         params.numShrinkThreads = *gen::inRange(2, 9);
+         std::vector<std::pair<CaseDescription, bool>> tries;
+         MockTestListener listener;
+         listener.onShrinkTriedCallback =
+             [&](const CaseDescription &desc, bool accepted) {
+               tries.emplace_back(desc, accepted);
+             };
+         const auto result = shrinkTestCase(shrinkable, params, listener);
+
+         RC_ASSERT(result.shrinkable.value() == expected.shrinkable.value());
+         RC_ASSERT(result.path == expected.path);
+         RC_ASSERT(tries == expectedTries);
+         RC_ASSERT(expected.numWastedShrinks == 0);
        });
+
+  SECTION("with cacheShrinks, does not evaluate identical shrinks again") {
+    // Every value shrinks to `0` twice before trying the next smaller value
+    const auto gen = Gen<int>([](const Random &, int) {
+      return shrinkable::shrinkRecur(10, [](int x) {
+        return (x == 0) ? Seq<int>() : seq::just(0, 0, x - 1);
+      });
+    });
+    int numCalls = 0;
+    const auto property = toProperty([&] {
+      const auto x = *gen;
+      numCalls++;
+      RC_ASSERT(x == 0);
+    });
+    const auto shrinkable = property(Random(), 0);
+    const auto expected =
+        shrinkTestCase(shrinkable, TestParams(), dummyListener);
+    // 30 shrinks plus one evaluation for each of the ten failing values when
+    // their shrinks are produced
+    REQUIRE(numCalls == 40);
+
+    numCalls = 0;
+    TestParams params;
+    params.cacheShrinks = true;
+    MockTestListener listener;
+    int numHits = -1;
+    int numMisses = -1;
+    listener.onShrinkCacheStatsCallback = [&](int hits, int misses) {
+      numHits = hits;
+      numMisses = misses;
+    };
+    const auto result = shrinkTestCase(shrinkable, params, listener);
+
+    REQUIRE(result.path == expected.path);
+    REQUIRE(listener.onShrinkTriedCount == 30);
+    REQUIRE(listener.onShrinkCacheStatsCount == 1);
+    // Only the first `0` is evaluated, failures are never cached
+    REQUIRE(numCalls == 20);
+    REQUIRE(numMisses == 20);
+    REQUIRE(numHits == 20);
+  }
+
+  SECTION("with cacheShrinks, does not confuse values that print the same") {
+    // Both shrinks print as `1` but only the second one fails
+    const auto gen = Gen<double>([](const Random &, int) {
+      return shrinkable::shrinkRecur(2.0, [](double x) {
+        return (x == 2.0) ? seq::just(1.0, 1.0 + 1e-9) : Seq<double>();
+      });
+    });
+    const auto property = toProperty([&] {
+      const auto x = *gen;
+      RC_ASSERT(x == 1.0);
+    });
+    const auto shrinkable = property(Random(), 0);
+    const auto expected =
+        shrinkTestCase(shrinkable, TestParams(), dummyListener);
+    REQUIRE(expected.path == std::vector<std::size_t>{1});
+
+    TestParams params;
+    params.cacheShrinks = true;
+    const auto result = shrinkTestCase(shrinkable, params, dummyListener);
+    REQUIRE(result.path == expected.path);
+  }
 }
 
 TEST_CASE("testProperty") {
@@ -511,6 +733,94 @@ TEST_CASE("testProperty") {
          RC_ASSERT(result.match(failure));
          RC_ASSERT(failure.counterExample.front().second == "1337");
        });
+
+  prop("reports command stats to the listener when enabled",
+       [](TestParams params) {
+         RC_PRE(params.maxSuccess > 0);
+         params.commandStats = true;
+         MockTestListener listener;
+         std::vector<CommandStats> stats;
+         listener.onCommandStatsCallback =
+             [&](const std::vector<CommandStats> &s) { stats = s; };
+         testProperty(toProperty([] {
+                        CommandStatsRecorder::current()->record("Command", 1);
+                      }),
+                      TestMetadata(),
+                      params,
+                      listener);
+
+         RC_ASSERT(listener.onCommandStatsCount == 1);
+         RC_ASSERT(stats.size() == 1U);
+         RC_ASSERT(stats[0].name == "Command");
+         RC_ASSERT(stats[0].latencies.count() ==
+                   static_cast<std::uint64_t>(params.maxSuccess));
+       });
+
+  prop("does not record command stats unless enabled",
+       [](TestParams params) {
+         RC_PRE(params.maxSuccess > 0);
+         params.commandStats = false;
+         MockTestListener listener;
+         testProperty(toProperty([] {
+                        RC_ASSERT(CommandStatsRecorder::current() == nullptr);
+                      }),
+                      TestMetadata(),
+                      params,
+                      listener);
+
+         RC_ASSERT(listener.onCommandStatsCount == 0);
+       });
+
+  prop("with a database, stores failures and replays them first",
+       [](TestParams params, const std::string &id) {
+         RC_PRE(params.maxSuccess > 0);
+         RC_PRE(!id.empty());
+         const auto directory = "rc_testing_db_" + std::to_string(params.seed);
+         ExampleDatabase database(directory);
+         TestMetadata metadata;
+         metadata.id = id;
+         const auto property = toProperty([](int) { RC_FAIL("fails"); });
+
+         const auto result1 = testProperty(
+             property, metadata, params, dummyListener, database);
+         FailureResult failure1;
+         RC_ASSERT(result1.match(failure1));
+         RC_ASSERT(database.load(id) ==
+                   std::vector<Reproduce>{failure1.reproduce});
+
+         params.seed = *gen::distinctFrom(params.seed);
+         MockTestListener listener;
+         const auto result2 =
+             testProperty(property, metadata, params, listener, database);
+         FailureResult failure2;
+         RC_ASSERT(result2.match(failure2));
+         RC_ASSERT(failure2.reproduce == failure1.reproduce);
+         RC_ASSERT(failure2.counterExample == failure1.counterExample);
+         // No random search was performed
+         RC_ASSERT(listener.onTestCaseFinishedCount == 0);
+
+         database.store(id, {});
+         std::remove(directory.c_str());
+       });
+
+  prop("with a database, removes entries that no longer fail",
+       [](const TestParams &params, const std::string &id) {
+         RC_PRE(!id.empty());
+         const auto directory = "rc_testing_db_" + std::to_string(params.seed);
+         ExampleDatabase database(directory);
+         Reproduce reproduce;
+         reproduce.random = Random(params.seed);
+         reproduce.size = 0;
+         database.add(id, reproduce);
+
+         TestMetadata metadata;
+         metadata.id = id;
+         const auto result = testProperty(
+             toProperty([](int) {}), metadata, params, dummyListener, database);
+         RC_ASSERT(result.is<SuccessResult>());
+         RC_ASSERT(database.load(id).empty());
+         std::remove(directory.c_str());
+       });
 }
 
 TEST_CASE("reproduceProperty") {
@@ -541,6 +851,28 @@ TEST_CASE("reproduceProperty") {
          RC_ASSERT(reproducedFailure.numSuccess == 0);
        });
 
+  prop("reproduces shrinks made with ddmin",
+       [](const TestMetadata &metadata, TestParams params) {
+         const auto property = toProperty([](const std::vector<int> &xs) {
+           RC_ASSERT(std::count(begin(xs), end(xs), 3) < 2);
+         });
+
+         params.maxSuccess = 2000;
+         params.maxSize = kNominalSize;
+         params.ddminThreshold = *gen::inRange(1, 5);
+
+         const auto result =
+             testProperty(property, metadata, params, dummyListener);
+         FailureResult failure;
+         RC_ASSERT(result.match(failure));
+         RC_ASSERT(failure.reproduce.ddminThreshold == params.ddminThreshold);
+
+         const auto reproduced = reproduceProperty(property, failure.reproduce);
+         FailureResult reproducedFailure;
+         RC_ASSERT(reproduced.match(reproducedFailure));
+         RC_ASSERT(failure.counterExample == reproducedFailure.counterExample);
+       });
+
   SECTION("returns error if reproduced result is not a failure") {
     const auto property = toProperty([] {});
     Reproduce repro;
@@ -0,0 +1,44 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace rc;
+
+namespace {
+
+struct Counted {
+  static std::atomic<int> numArbitraryCalls;
+};
+
+std::atomic<int> Counted::numArbitraryCalls(0);
+
+} // namespace
+
+namespace rc {
+
+template <>
+struct Arbitrary<Counted> {
+  static Gen<Counted> arbitrary() {
+    Counted::numArbitraryCalls++;
+    return gen::just(Counted());
+  }
+};
+
+} // namespace rc
+
+TEST_CASE("gen::arbitrary") {
+  SECTION("creates the generator only once") {
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < 4; i++) {
+      threads.emplace_back([] { gen::arbitrary<Counted>(); });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    gen::arbitrary<Counted>();
+
+    REQUIRE(Counted::numArbitraryCalls == 1);
+  }
+}
@@ -170,6 +170,22 @@ struct ArbitraryProperties {
   }
 };
 
+struct FlatArbitraryProperties {
+  template <typename T>
+  static void exec() {
+    using Element = typename T::value_type;
+
+    templatedProp<T>(
+        "is equivalent to a container of arbitrary elements",
+        [](const Random &random) {
+          const auto size = *gen::inRange<int>(0, 200);
+          assertEquivalent(
+              gen::arbitrary<T>()(random, size),
+              gen::container<T>(gen::arbitrary<Element>())(random, size));
+        });
+  }
+};
+
 } // namespace
 
 TEST_CASE("gen::container") {
@@ -208,6 +224,12 @@ TEST_CASE("gen::container") {
               std::array<Predictable, 5>,
               std::array<NonCopyable, 5>>();
 
+  forEachType<FlatArbitraryProperties,
+              RC_SEQUENCE_CONTAINERS(int),
+              RC_SEQUENCE_CONTAINERS(bool),
+              RC_SEQUENCE_CONTAINERS(double),
+              std::vector<uint8_t>>();
+
   forEachType<RetrialProperties<MapFactory>,
               std::map<int, int>,
               std::unordered_map<int, int>>();
@@ -1,6 +1,8 @@
 #include <catch2/catch.hpp>
 #include <rapidcheck/catch.h>
 
+#include <thread>
+
 #include "rapidcheck/gen/Exec.h"
 
 #include "util/Predictable.h"
@@ -56,4 +58,40 @@ TEST_CASE("gen::exec") {
 
          RC_ASSERT(execGen(Random(), 0) == bindGen(Random(), 0));
        });
+
+  SECTION("can be used from several threads at once") {
+    const auto execGen = gen::exec([] {
+      std::vector<int> values;
+      const auto n = *gen::inRange(0, 20);
+      for (int i = 0; i < n; i++) {
+        values.push_back(*gen::arbitrary<int>());
+      }
+      values.push_back(*gen::exec([] { return *gen::arbitrary<int>(); }));
+      return values;
+    });
+
+    const std::size_t numThreads = 8;
+    const std::size_t numValues = 200;
+    std::vector<std::vector<int>> expected;
+    for (std::size_t i = 0; i < numValues; i++) {
+      expected.push_back(execGen(Random(i), kNominalSize).value());
+    }
+
+    std::vector<std::vector<std::vector<int>>> actual(numThreads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < numThreads; t++) {
+      threads.emplace_back([&, t] {
+        for (std::size_t i = 0; i < numValues; i++) {
+          actual[t].push_back(execGen(Random(i), kNominalSize).value());
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    for (const auto &values : actual) {
+      REQUIRE(values == expected);
+    }
+  }
 }
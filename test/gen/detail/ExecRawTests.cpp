@@ -9,6 +9,7 @@
 #include "util/ArbitraryRandom.h"
 
 #include "rapidcheck/gen/detail/ExecRaw.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
 #include "rapidcheck/shrinkable/Operations.h"
 #include "rapidcheck/seq/Operations.h"
 
@@ -203,12 +204,11 @@ TEST_CASE("execRaw") {
           std::vector<int> actual;
 
           const auto argTuple =
-              recipe.ingredients.front().value().get<ArgTuple>();
+              recipe.ingredient(0)->value().get<ArgTuple>();
           actual.push_back(std::get<0>(argTuple).value);
 
-          auto it = recipe.ingredients.begin() + 1;
-          for (; it != end(recipe.ingredients); it++) {
-            actual.push_back(it->value().get<int>());
+          for (std::size_t i = 1; i < recipe.numIngredients(); i++) {
+            actual.push_back(recipe.ingredient(i)->value().get<int>());
           }
 
           return actual == pair.first;
@@ -223,7 +223,7 @@ TEST_CASE("execRaw") {
 
   SECTION("empty arguments don't show up in tuple") {
     const auto value = execRaw([] { return 0; })(Random(), 0).value();
-    REQUIRE(value.second.ingredients.empty());
+    REQUIRE(value.second.numIngredients() == 0);
   }
 
   prop("disallows nested use of operator*",
@@ -237,4 +237,18 @@ TEST_CASE("execRaw") {
          const auto shrinkable = gen(params.random, params.size);
          RC_ASSERT_THROWS(shrinkable.value());
        });
+
+  prop("generators see implicit parameters bound outside of execRaw",
+       [](const GenParams &params) {
+         const auto threshold = *gen::positive<int>();
+         rc::detail::ImplicitParam<param::DdminThreshold> letThreshold(
+             threshold);
+         const auto gen = execRaw([] {
+           return *Gen<int>([](const Random &, int) {
+             return shrinkable::just(
+                 rc::detail::ImplicitParam<param::DdminThreshold>::value());
+           });
+         });
+         RC_ASSERT(gen(params.random, params.size).value().first == threshold);
+       });
 }
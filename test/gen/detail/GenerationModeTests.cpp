@@ -0,0 +1,69 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+
+#include <array>
+#include <set>
+
+#include "util/ArbitraryRandom.h"
+#include "util/Meta.h"
+
+#include "rapidcheck/gen/detail/ExecRaw.h"
+#include "rapidcheck/gen/detail/GenerationMode.h"
+
+using namespace rc;
+using namespace rc::test;
+using namespace rc::gen::detail;
+
+namespace {
+
+struct ValuesOnlyProperties {
+  template <typename T>
+  static void exec() {
+    templatedProp<T>(
+        "produces the same values without shrinks when only values are needed",
+        [] {
+          const auto random = *gen::arbitrary<Random>();
+          const auto size = *gen::inRange(0, 200);
+          const auto gen = gen::arbitrary<T>();
+          const auto expected = gen(random, size).value();
+          rc::detail::ImplicitParam<param::ValuesOnly> letValuesOnly(true);
+          const auto shrinkable = gen(random, size);
+          RC_ASSERT(shrinkable.value() == expected);
+          RC_ASSERT(!shrinkable.shrinks().next());
+        });
+  }
+};
+
+} // namespace
+
+TEST_CASE("param::ValuesOnly") {
+  forEachType<ValuesOnlyProperties,
+              int,
+              double,
+              bool,
+              char,
+              std::string,
+              std::vector<int>,
+              std::vector<std::string>,
+              std::set<int>,
+              std::array<int, 5>>();
+
+  prop("only applies to generated values and not to the callable of execRaw",
+       [] {
+         const auto random = *gen::arbitrary<Random>();
+         const auto size = *gen::inRange(0, 200);
+         const auto gen = execRaw([](int x) {
+           RC_ASSERT(!rc::detail::ImplicitParam<param::ValuesOnly>::value());
+           return std::make_pair(x, *gen::arbitrary<std::string>());
+         });
+         const auto expected = gen(random, size).value().first;
+
+         rc::detail::ImplicitParam<param::ValuesOnly> letValuesOnly(true);
+         const auto result = gen(random, size).value();
+         RC_ASSERT(result.first == expected);
+         const auto &recipe = result.second;
+         for (std::size_t i = 0; i < recipe.numIngredients(); i++) {
+           RC_ASSERT(!recipe.ingredient(i)->shrinkable.shrinks().next());
+         }
+       });
+}
@@ -34,10 +34,31 @@ struct Arbitrary<Recipe> {
       recipe.random = *gen::arbitrary<Random>();
       recipe.size = *gen::inRange<int>(0, 200);
       const auto numIngredients = *gen::inRange<std::size_t>(0, 5);
-      recipe.ingredients = *gen::container<Recipe::Ingredients>(
-          numIngredients, gen::arbitrary<Recipe::Ingredient>());
-      recipe.numFixed =
-          *gen::inRange<std::size_t>(0, recipe.ingredients.size() + 1);
+      auto ingredients = *gen::container<Recipe::Ingredients>(
+          numIngredients,
+          gen::map<Recipe::Ingredient>([](Recipe::Ingredient &&ingredient) {
+            return std::make_shared<const Recipe::Ingredient>(
+                std::move(ingredient));
+          }));
+      // Some of the ingredients may be shared, possibly with a vector that
+      // has more ingredients than belong to the recipe
+      const auto numShared = *gen::inRange<std::size_t>(0, numIngredients + 1);
+      const auto numExtra = *gen::inRange<std::size_t>(0, 2);
+      if ((numShared != 0) || (numExtra != 0)) {
+        auto shared = std::make_shared<Recipe::Ingredients>(
+            begin(ingredients), begin(ingredients) + numShared);
+        for (std::size_t i = 0; i < numExtra; i++) {
+          shared->push_back(*gen::map<Recipe::Ingredient>(
+              [](Recipe::Ingredient &&ingredient) {
+                return std::make_shared<const Recipe::Ingredient>(
+                    std::move(ingredient));
+              }));
+        }
+        recipe.shared = std::move(shared);
+      }
+      recipe.numShared = numShared;
+      recipe.added.assign(begin(ingredients) + numShared, end(ingredients));
+      recipe.numFixed = *gen::inRange<std::size_t>(0, numIngredients + 1);
       return recipe;
     });
   }
@@ -56,10 +77,19 @@ bool equalAsInt(Shrinkable<Any> lhs, Shrinkable<Any> rhs) {
   return mapToInt(std::move(lhs)) == mapToInt(std::move(rhs));
 }
 
-bool equalIntIngredients(const Recipe::Ingredient &lhs,
-                         const Recipe::Ingredient &rhs) {
-  return (lhs.description == rhs.description) &&
-      equalAsInt(lhs.shrinkable, rhs.shrinkable);
+using IngredientPtr = Recipe::IngredientPtr;
+
+bool equalIntIngredients(const IngredientPtr &lhs, const IngredientPtr &rhs) {
+  return (*lhs->description == *rhs->description) &&
+      equalAsInt(lhs->shrinkable, rhs->shrinkable);
+}
+
+Recipe::Ingredients ingredientsOf(const Recipe &recipe) {
+  Recipe::Ingredients ingredients;
+  for (std::size_t i = 0; i < recipe.numIngredients(); i++) {
+    ingredients.push_back(recipe.ingredient(i));
+  }
+  return ingredients;
 }
 
 } // namespace
@@ -78,10 +108,12 @@ TEST_CASE("shrinkRecipe") {
        [](const Recipe &recipe) {
          RC_ASSERT(seq::all(shrinkRecipe(recipe),
                             [&](const Recipe &shrink) {
-                              return std::equal(recipe.ingredients.begin(),
-                                                recipe.ingredients.begin() +
+                              const auto expected = ingredientsOf(recipe);
+                              const auto actual = ingredientsOf(shrink);
+                              return std::equal(expected.begin(),
+                                                expected.begin() +
                                                     recipe.numFixed,
-                                                shrink.ingredients.begin(),
+                                                actual.begin(),
                                                 equalIntIngredients);
                             }));
        });
@@ -90,21 +122,35 @@ TEST_CASE("shrinkRecipe") {
        [](const Recipe &recipe) {
          RC_ASSERT(seq::all(shrinkRecipe(recipe),
                             [&](const Recipe &shrink) {
-                              const auto size = shrink.ingredients.size() - 1;
-                              return std::equal(recipe.ingredients.begin(),
-                                                recipe.ingredients.begin() +
-                                                    size,
-                                                shrink.ingredients.begin(),
+                              const auto expected = ingredientsOf(recipe);
+                              const auto actual = ingredientsOf(shrink);
+                              const auto size = actual.size() - 1;
+                              return std::equal(expected.begin(),
+                                                expected.begin() + size,
+                                                actual.begin(),
                                                 equalIntIngredients);
                             }));
        });
 
+  prop("shares the unchanged ingredients with the original",
+       [](const Recipe &recipe) {
+         RC_ASSERT(seq::all(shrinkRecipe(recipe),
+                            [&](const Recipe &shrink) {
+                              const auto expected = ingredientsOf(recipe);
+                              const auto actual = ingredientsOf(shrink);
+                              const auto size = actual.size() - 1;
+                              return std::equal(expected.begin(),
+                                                expected.begin() + size,
+                                                actual.begin());
+                            }));
+       });
+
   prop("sets all values except last to fixed",
        [](const Recipe &recipe) {
          RC_ASSERT(seq::all(shrinkRecipe(recipe),
                             [&](const Recipe &shrink) {
                               return shrink.numFixed ==
-                                  (shrink.ingredients.size() - 1);
+                                  (shrink.numIngredients() - 1);
                             }));
        });
 
@@ -112,14 +158,13 @@ TEST_CASE("shrinkRecipe") {
        [](const Recipe &recipe) {
          RC_ASSERT(seq::all(shrinkRecipe(recipe),
                             [&](const Recipe &shrink) {
-                              const auto i = shrink.ingredients.size() - 1;
-                              auto shrinks =
-                                  recipe.ingredients[i].shrinks();
+                              const auto i = shrink.numIngredients() - 1;
+                              auto shrinks = recipe.ingredient(i)->shrinks();
                               return seq::any(
                                   std::move(shrinks),
                                   [&](const Shrinkable<Any> &s) {
                                     return equalAsInt(
-                                        s, shrink.ingredients[i].shrinkable);
+                                        s, shrink.ingredient(i)->shrinkable);
                                   });
                             }));
        });
@@ -128,15 +173,15 @@ TEST_CASE("shrinkRecipe") {
        [](const Recipe &recipe) {
          RC_ASSERT(seq::all(shrinkRecipe(recipe),
                             [&](const Recipe &shrink) {
-                              const auto i = shrink.ingredients.size() - 1;
-                              return (shrink.ingredients[i].description ==
-                                      recipe.ingredients[i].description);
+                              const auto i = shrink.numIngredients() - 1;
+                              return (shrink.ingredient(i)->description ==
+                                      recipe.ingredient(i)->description);
                             }));
        });
 
   prop("yields empty sequence if all values are fixed",
        [](Recipe recipe) {
-         recipe.numFixed = recipe.ingredients.size();
+         recipe.numFixed = recipe.numIngredients();
          RC_ASSERT(!shrinkRecipe(recipe).next());
        });
 
@@ -151,20 +196,21 @@ TEST_CASE("shrinkRecipe") {
 
         const auto i = *gen::suchThat(
             gen::inRange<std::size_t>(recipe.numFixed,
-                                      recipe.ingredients.size()),
+                                      recipe.numIngredients()),
             [&](std::size_t x) {
-              return bool(recipe.ingredients[x].shrinks().next());
+              return bool(recipe.ingredient(x)->shrinks().next());
             });
 
-        const auto shrinks = recipe.ingredients[i].shrinks();
+        const auto shrinks = recipe.ingredient(i)->shrinks();
         const auto numShrinks = seq::length(shrinks);
         const auto shrinkIndex = *gen::inRange<std::size_t>(0, numShrinks);
         const auto expectedShrink = *seq::at(shrinks, shrinkIndex);
         RC_ASSERT(
             seq::any(shrinkRecipe(recipe),
                      [&](const Recipe &shrink) {
-                       return (shrink.ingredients.size() > i) &&
-                           (equalAsInt(shrink.ingredients[i].shrinkable, expectedShrink));
+                       return (shrink.numIngredients() > i) &&
+                           (equalAsInt(shrink.ingredient(i)->shrinkable,
+                                       expectedShrink));
                      }));
       });
 }
@@ -5,6 +5,8 @@
 
 #include "rapidcheck/shrink/Shrink.h"
 #include "rapidcheck/seq/Operations.h"
+#include "rapidcheck/shrinkable/Create.h"
+#include "rapidcheck/shrinkable/Operations.h"
 
 #include "util/Util.h"
 #include "util/Meta.h"
@@ -88,6 +90,94 @@ TEST_CASE("shrink::removeChunks") {
 
 namespace {
 
+template <typename T>
+bool isSubsequence(const T &sub, const T &elements) {
+  auto it = begin(elements);
+  for (const auto &x : sub) {
+    it = std::find(it, end(elements), x);
+    if (it == end(elements)) {
+      return false;
+    }
+    it++;
+  }
+  return true;
+}
+
+struct DdminProperties {
+  template <typename T>
+  static void exec() {
+    static const auto fewValues = gen::scale(0.3, gen::arbitrary<T>());
+    static const auto fewNonEmptyValues =
+        gen::suchThat(fewValues, [](const T &x) { return !x.empty(); });
+
+    templatedProp<T>("first tries empty collection",
+                     [] {
+                       const auto collection = *fewNonEmptyValues;
+                       RC_ASSERT(shrink::ddmin(collection).next()->empty());
+                     });
+
+    templatedProp<T>("shrinks to a subsequence of the original",
+                     [] {
+                       const auto elements = *fewValues;
+                       seq::forEach(shrink::ddmin(elements),
+                                    [&](T &&c) {
+                                      RC_ASSERT(c.size() < elements.size());
+                                      RC_ASSERT(isSubsequence(c, elements));
+                                    });
+                     });
+
+    templatedProp<T>("every removal of a single element is a possible shrink",
+                     [] {
+                       const auto elements = *fewNonEmptyValues;
+                       const auto i = *gen::inRange<std::size_t>(
+                           0, elements.size());
+                       auto shrink = elements;
+                       shrink.erase(begin(shrink) + i);
+                       RC_ASSERT(seq::contains(shrink::ddmin(elements), shrink));
+                     });
+
+    templatedProp<T>("yields a number of shrinks linear in the size",
+                     [] {
+                       const auto elements = *fewValues;
+                       RC_ASSERT(seq::length(shrink::ddmin(elements)) <=
+                                 (elements.size() * 6 + 1));
+                     });
+  }
+};
+
+} // namespace
+
+TEST_CASE("shrink::ddmin") {
+  forEachType<DdminProperties, std::vector<char>, std::string>();
+
+  prop("finds a minimal container with two given elements",
+       [] {
+         const auto elements = *gen::nonEmpty<std::vector<int>>();
+         const auto a = *gen::elementOf(elements);
+         const auto b = *gen::elementOf(elements);
+         const auto shrinkable =
+             shrinkable::shrinkRecur(elements, &shrink::ddmin<std::vector<int>>);
+         const auto contains = [](const std::vector<int> &c, int x) {
+           return std::find(begin(c), end(c), x) != end(c);
+         };
+
+         const auto result = shrinkable::findLocalMin(
+             shrinkable,
+             [&](const std::vector<int> &c) {
+               return contains(c, a) && contains(c, b);
+             }).first;
+         RC_ASSERT(result.size() == ((a == b) ? 1U : 2U));
+       });
+
+  SECTION("yields far fewer shrinks than removeChunks for large containers") {
+    const std::vector<char> elements(200, 'x');
+    REQUIRE((seq::length(shrink::ddmin(elements)) * 10) <
+            seq::length(shrink::removeChunks(elements)));
+  }
+}
+
+namespace {
+
 struct EachElementProperties {
   template <typename T>
   static void exec() {
@@ -73,6 +73,26 @@ TEST_CASE("state::runAll") {
          NonCopyableModel sut;
          state::runAll(cmds, &initialNonCopyableModel, sut);
        });
+
+  prop("records the runs of commands if there is a current recorder",
+       [](const IntVec &s0) {
+         const auto cmds = *pushBackCommands();
+         rc::detail::CommandStatsRecorder recorder;
+         {
+           rc::detail::CommandStatsScope scope(&recorder);
+           IntVec sut(s0);
+           runAll(cmds, s0, sut);
+         }
+
+         const auto stats = recorder.stats();
+         if (cmds.empty()) {
+           RC_ASSERT(stats.empty());
+         } else {
+           RC_ASSERT(stats.size() == 1U);
+           RC_ASSERT(stats[0].name.find("PushBack") != std::string::npos);
+           RC_ASSERT(stats[0].latencies.count() == cmds.size());
+         }
+       });
 }
 
 TEST_CASE("state::isValidSequence") {
@@ -0,0 +1,188 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+#include <rapidcheck/state.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "util/GenUtils.h"
+
+using namespace rc;
+using namespace rc::detail;
+using namespace rc::test;
+using namespace rc::state::detail;
+
+namespace {
+
+// A counter where `increment` returns the new value.
+struct Counter {
+  virtual int increment() = 0;
+  virtual ~Counter() = default;
+};
+
+struct LockedCounter : public Counter {
+  int increment() override {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ++value;
+  }
+
+  std::mutex mutex;
+  int value = 0;
+};
+
+// Deliberately racy, the sleep makes it very likely that concurrent increments
+// read the same value.
+struct RacyCounter : public Counter {
+  int increment() override {
+    const int current = value.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    value.store(current + 1);
+    return current + 1;
+  }
+
+  std::atomic<int> value{0};
+};
+
+using CounterCmd = state::Command<int, Counter>;
+
+struct Increment : public CounterCmd {
+  void apply(int &s0) const override { s0++; }
+
+  void run(const int &s0, Counter &sut) const override {
+    RC_ASSERT(sut.increment() == (s0 + 1));
+  }
+
+  std::function<void(const int &)>
+  runConcurrently(Counter &sut) const override {
+    const auto result = sut.increment();
+    return [=](const int &s0) { RC_ASSERT(result == (s0 + 1)); };
+  }
+};
+
+// Only valid when the counter is even.
+struct EvenIncrement : public Increment {
+  void checkPreconditions(const int &s0) const override {
+    RC_PRE((s0 % 2) == 0);
+  }
+};
+
+using IncrementHistory = ConcurrentHistory<CounterCmd>;
+
+ConcurrentOperation<CounterCmd> operation(int result,
+                                          std::uint64_t invoked,
+                                          std::uint64_t returned) {
+  ConcurrentOperation<CounterCmd> op;
+  op.command = std::make_shared<Increment>();
+  op.verify = [=](const int &s0) { RC_ASSERT(result == (s0 + 1)); };
+  op.invoked = invoked;
+  op.returned = returned;
+  return op;
+}
+
+} // namespace
+
+TEST_CASE("LinearizabilityChecker") {
+  using Checker = LinearizabilityChecker<CounterCmd>;
+
+  SECTION("accepts histories that agree with the model in the order they ran") {
+    IncrementHistory history{{operation(1, 0, 1)}, {operation(2, 2, 3)}};
+    REQUIRE(Checker(history).check(0) == Checker::Result::Linearizable);
+  }
+
+  SECTION("reorders operations that overlap in time") {
+    IncrementHistory history{{operation(2, 0, 3)}, {operation(1, 1, 2)}};
+    REQUIRE(Checker(history).check(0) == Checker::Result::Linearizable);
+  }
+
+  SECTION("does not reorder operations that do not overlap in time") {
+    IncrementHistory history{{operation(2, 0, 1)}, {operation(1, 2, 3)}};
+    Checker checker(history);
+    REQUIRE(checker.check(0) == Checker::Result::NotLinearizable);
+    REQUIRE(!checker.failureDescription().empty());
+  }
+
+  SECTION("rejects histories where no order agrees with the model") {
+    IncrementHistory history{{operation(1, 0, 3)}, {operation(1, 1, 2)}};
+    REQUIRE(Checker(history).check(0) == Checker::Result::NotLinearizable);
+  }
+
+  SECTION("reports when no order satisfies the preconditions") {
+    auto op = operation(1, 0, 1);
+    op.command = std::make_shared<EvenIncrement>();
+    IncrementHistory history{{op}};
+    REQUIRE(Checker(history).check(1) == Checker::Result::NoValidOrder);
+  }
+
+  SECTION("memoizes explored model states") {
+    // Three threads with four overlapping operations each have tens of
+    // thousands of interleavings but only a hundred or so distinct positions
+    IncrementHistory history(3);
+    for (auto &ops : history) {
+      for (int i = 0; i < 4; i++) {
+        auto op = operation(0, 0, 1000);
+        op.verify = [](const int &) {};
+        ops.push_back(op);
+      }
+    }
+    auto &last = history[0].back();
+    last.verify = [](const int &) { RC_FAIL("Never agrees"); };
+
+    Checker checker(history);
+    REQUIRE(checker.check(0) == Checker::Result::NotLinearizable);
+    REQUIRE(checker.numExplored() <= (5 * 5 * 5));
+  }
+}
+
+TEST_CASE("state::checkParallel") {
+  prop("succeeds for a correctly synchronized system",
+       [] {
+         LockedCounter sut;
+         state::ParallelOptions options;
+         options.numThreads = *gen::inRange(1, 4);
+         options.maxCommandsPerThread = 5;
+         state::checkParallel(
+             0, sut, state::gen::execOneOfWithArgs<Increment>(), options);
+       });
+
+  SECTION("finds races") {
+    state::ParallelCommands<CounterCmd> commands;
+    for (int i = 0; i < 2; i++) {
+      commands.suffixes.push_back(
+          {std::make_shared<Increment>(), std::make_shared<Increment>()});
+    }
+
+    // Scheduling could in theory hide the race so give it a few tries
+    bool found = false;
+    for (int i = 0; (i < 20) && !found; i++) {
+      RacyCounter sut;
+      try {
+        state::runParallel(commands, 0, sut);
+      } catch (const CaseResult &result) {
+        REQUIRE(result.type == CaseResult::Type::Failure);
+        found = true;
+      }
+    }
+    REQUIRE(found);
+  }
+
+  prop("generates sequences of the requested shape",
+       [](const GenParams &params) {
+         state::ParallelOptions options;
+         options.numThreads = *gen::inRange(1, 5);
+         options.maxCommandsPerThread = *gen::inRange(1, 10);
+         const auto commands =
+             state::gen::parallelCommands(
+                 0, state::gen::execOneOfWithArgs<Increment>(), options)(
+                 params.random, params.size)
+                 .value();
+
+         RC_ASSERT(commands.suffixes.size() ==
+                   static_cast<std::size_t>(options.numThreads));
+         for (const auto &suffix : commands.suffixes) {
+           RC_ASSERT(!suffix.empty());
+           RC_ASSERT(suffix.size() <=
+                     static_cast<std::size_t>(options.maxCommandsPerThread));
+         }
+       });
+}
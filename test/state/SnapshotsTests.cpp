@@ -0,0 +1,173 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+#include <rapidcheck/state.h>
+
+#include <algorithm>
+
+#include "util/GenUtils.h"
+
+using namespace rc;
+using namespace rc::test;
+
+namespace {
+
+struct Log {
+  std::vector<int> items;
+
+  bool operator==(const Log &other) const { return items == other.items; }
+};
+
+using LogCommand = state::Command<Log, Log>;
+
+struct Append : public LogCommand {
+  int item = *gen::inRange<int>(0, 10);
+
+  explicit Append(const Log & /*s0*/) {}
+  explicit Append(int x)
+      : item(x) {}
+
+  void apply(Model &s0) const override { s0.items.push_back(item); }
+
+  void run(const Model &s0, Sut &sut) const override {
+    sut.items.push_back(item);
+    RC_ASSERT(sut == nextState(s0));
+  }
+
+  void show(std::ostream &os) const override { os << "Append(" << item << ")"; }
+};
+
+struct BuggyCheck : public LogCommand {
+  explicit BuggyCheck(const Log & /*s0*/) {}
+
+  void run(const Model &s0, Sut &sut) const override {
+    RC_ASSERT(std::count(begin(sut.items), end(sut.items), 3) < 2);
+  }
+
+  void show(std::ostream &os) const override { os << "BuggyCheck"; }
+};
+
+state::Commands<LogCommand> appends(int n) {
+  state::Commands<LogCommand> commands;
+  for (int i = 0; i < n; i++) {
+    commands.push_back(std::make_shared<Append>(i));
+  }
+  return commands;
+}
+
+Log appended(int n) {
+  Log log;
+  for (int i = 0; i < n; i++) {
+    log.items.push_back(i);
+  }
+  return log;
+}
+
+} // namespace
+
+TEST_CASE("state::runAllWithSnapshots") {
+  state::clearSnapshots<Log, Log>();
+  const auto commands = appends(40);
+  Log sut1;
+  const auto stats1 = state::runAllWithSnapshots(commands, Log(), sut1);
+  REQUIRE(sut1 == appended(40));
+  REQUIRE(stats1.commandsRun == 40);
+  REQUIRE(stats1.commandsSkipped == 0);
+
+  SECTION("resumes from the longest prefix") {
+    Log sut2;
+    const auto stats2 = state::runAllWithSnapshots(commands, Log(), sut2);
+    REQUIRE(sut2 == appended(40));
+    REQUIRE(stats2.commandsRun == 8);
+    REQUIRE(stats2.commandsSkipped == 32);
+  }
+
+  SECTION("resumes shorter sequences with the same prefix") {
+    const state::Commands<LogCommand> prefix(begin(commands),
+                                             begin(commands) + 20);
+    Log sut2;
+    const auto stats2 = state::runAllWithSnapshots(prefix, Log(), sut2);
+    REQUIRE(sut2 == appended(20));
+    REQUIRE(stats2.commandsRun == 4);
+    REQUIRE(stats2.commandsSkipped == 16);
+  }
+
+  SECTION("matches commands by identity") {
+    Log sut2;
+    const auto stats2 = state::runAllWithSnapshots(appends(40), Log(), sut2);
+    REQUIRE(sut2 == appended(40));
+    REQUIRE(stats2.commandsSkipped == 0);
+  }
+
+  SECTION("does not resume when the initial state differs") {
+    Log s0;
+    s0.items.push_back(-1);
+    Log sut2 = s0;
+    const auto stats2 = state::runAllWithSnapshots(commands, s0, sut2);
+    REQUIRE(sut2.items.size() == 41U);
+    REQUIRE(stats2.commandsSkipped == 0);
+  }
+
+  SECTION("keeps at most maxSnapshots snapshots") {
+    state::clearSnapshots<Log, Log>();
+    state::SnapshotOptions options;
+    options.interval = 4;
+    options.maxSnapshots = 3;
+    Log sut2;
+    state::runAllWithSnapshots(commands, Log(), sut2, options);
+    REQUIRE(state::detail::snapshotCache<Log, Log>().size() == 3U);
+
+    Log sut3;
+    const auto stats3 =
+        state::runAllWithSnapshots(commands, Log(), sut3, options);
+    REQUIRE(stats3.commandsSkipped == 36);
+  }
+
+  state::clearSnapshots<Log, Log>();
+}
+
+TEST_CASE("state::checkWithSnapshots") {
+  prop("finds the same minimum as runAll",
+       [](const GenParams &params) {
+         const auto gen = state::gen::commands(
+             Log(), state::gen::execOneOfWithArgs<Append, BuggyCheck>());
+         const auto withSnapshots = searchGen(
+             params.random,
+             params.size,
+             gen,
+             [](const state::Commands<LogCommand> &cmds) {
+               Log sut;
+               try {
+                 state::runAllWithSnapshots(cmds, Log(), sut);
+               } catch (...) {
+                 return true;
+               }
+               return false;
+             });
+         state::clearSnapshots<Log, Log>();
+
+         const auto withoutSnapshots = searchGen(
+             params.random,
+             params.size,
+             gen,
+             [](const state::Commands<LogCommand> &cmds) {
+               Log sut;
+               try {
+                 runAll(cmds, Log(), sut);
+               } catch (...) {
+                 return true;
+               }
+               return false;
+             });
+
+         RC_ASSERT(toString(withSnapshots) == toString(withoutSnapshots));
+       });
+
+  prop("passes for a correct system",
+       [] {
+         Log sut;
+         const auto stats = state::checkWithSnapshots(
+             Log(), sut, state::gen::execOneOfWithArgs<Append>());
+         RC_ASSERT(sut.items.size() ==
+                   (stats.commandsRun + stats.commandsSkipped));
+       });
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch.hpp>
+#include <rapidcheck/catch.h>
+#include <rapidcheck/state.h>
+
+using namespace rc;
+
+namespace {
+
+struct Counter {
+  int value = 0;
+};
+
+using CounterCmd = state::Command<int, Counter>;
+
+struct Increment : public CounterCmd {
+  void apply(int &s0) const override { s0++; }
+
+  void run(const int &s0, Counter &sut) const override {
+    RC_ASSERT(++sut.value == (s0 + 1));
+  }
+};
+
+std::unique_ptr<Counter> makeCounter() {
+  return std::unique_ptr<Counter>(new Counter());
+}
+
+void resetCounter(Counter &counter) { counter.value = 0; }
+
+} // namespace
+
+TEST_CASE("state::SutPool") {
+  SECTION("constructs when there is no idle system under test") {
+    state::SutPool<Counter> pool(&makeCounter, &resetCounter);
+    const auto lease1 = pool.acquire();
+    const auto lease2 = pool.acquire();
+    REQUIRE(&*lease1 != &*lease2);
+    REQUIRE(pool.stats().constructions == 2U);
+    REQUIRE(pool.stats().resets == 0U);
+  }
+
+  SECTION("resets and reuses released systems under test") {
+    state::SutPool<Counter> pool(&makeCounter, &resetCounter);
+    Counter *counter;
+    {
+      const auto lease = pool.acquire();
+      lease->value = 1337;
+      counter = &*lease;
+    }
+
+    const auto lease = pool.acquire();
+    REQUIRE(&*lease == counter);
+    REQUIRE(lease->value == 0);
+    REQUIRE(pool.stats().constructions == 1U);
+    REQUIRE(pool.stats().resets == 1U);
+  }
+
+  SECTION("constructs a new system under test if reset throws") {
+    state::SutPool<Counter> pool(&makeCounter, [](Counter &counter) {
+      if (counter.value != 0) {
+        throw std::runtime_error("Cannot reset");
+      }
+    });
+    pool.acquire()->value = 1;
+
+    const auto lease = pool.acquire();
+    REQUIRE(lease->value == 0);
+    REQUIRE(pool.stats().constructions == 2U);
+    REQUIRE(pool.stats().resets == 0U);
+    REQUIRE(pool.stats().failedResets == 1U);
+  }
+
+  SECTION("never reuses without a reset") {
+    state::SutPool<Counter> pool(&makeCounter);
+    pool.acquire();
+    pool.acquire();
+    REQUIRE(pool.stats().constructions == 2U);
+    REQUIRE(pool.stats().resets == 0U);
+  }
+
+  prop("check borrows the system under test from the pool",
+       [] {
+         state::SutPool<Counter> pool(&makeCounter, &resetCounter);
+         const auto n = *gen::inRange(1, 10);
+         for (int i = 0; i < n; i++) {
+           state::check(0, pool, state::gen::execOneOfWithArgs<Increment>());
+         }
+
+         RC_ASSERT(pool.stats().constructions == 1U);
+         RC_ASSERT(pool.stats().resets == static_cast<std::uint64_t>(n - 1));
+       });
+
+  prop("the system under test is returned to the pool on failure",
+       [] {
+         state::SutPool<Counter> pool(&makeCounter, &resetCounter);
+         try {
+           // The model and the system under test disagree from the start
+           state::check(1, pool, state::gen::execOneOfWithArgs<Increment>());
+         } catch (const detail::CaseResult &result) {
+           RC_ASSERT(result.type == detail::CaseResult::Type::Failure);
+         }
+
+         pool.acquire();
+         RC_ASSERT(pool.stats().constructions == 1U);
+         RC_ASSERT(pool.stats().resets == 1U);
+       });
+}
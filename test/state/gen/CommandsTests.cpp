@@ -80,6 +80,17 @@ struct DeprecatedCmd : public IntVecCmd {
   void apply(IntVec &s0) const override { RC_DISCARD(); }
 };
 
+struct CountApplyCmd : public IntVecCmd {
+  static int numApplies;
+
+  void apply(IntVec &s0) const override {
+    numApplies++;
+    s0.push_back(0);
+  }
+};
+
+int CountApplyCmd::numApplies = 0;
+
 } // namespace
 
 TEST_CASE("state::gen::commands") {
@@ -303,4 +314,28 @@ TEST_CASE("state::gen::commands") {
          RC_ASSERT_THROWS_AS(gen(params.random, params.size).value(),
                              GenerationFailure);
        });
+
+  SECTION("shrinking resumes from checkpointed states") {
+    const auto gen = state::gen::commands(
+        IntVec(), state::gen::execOneOfWithArgs<CountApplyCmd>());
+    auto random = Random();
+    auto shrinkable = gen(random, 200);
+    while (shrinkable.value().size() < 100) {
+      random = random.split();
+      shrinkable = gen(random, 200);
+    }
+
+    // Replaying every candidate from the initial state takes as many applies
+    // as the candidate has commands. The individual shrinks of each command
+    // also need the state before it.
+    const auto n = static_cast<int>(shrinkable.value().size());
+    int numReplayApplies = (n * (n - 1)) / 2;
+    CountApplyCmd::numApplies = 0;
+    seq::forEach(shrinkable.shrinks(),
+                 [&](const Shrinkable<IntVecCmds> &shrink) {
+                   numReplayApplies += shrink.value().size();
+                 });
+
+    REQUIRE(CountApplyCmd::numApplies < numReplayApplies);
+  }
 }
@@ -12,11 +12,19 @@
 
 namespace rc {
 
+template <>
+struct Arbitrary<Random::Engine> {
+  static Gen<Random::Engine> arbitrary() {
+    return gen::element(Random::Engine::Default, Random::Engine::Fast);
+  }
+};
+
 template <>
 struct Arbitrary<detail::TestParams> {
   static Gen<detail::TestParams> arbitrary() {
     return gen::build<detail::TestParams>(
         gen::set(&detail::TestParams::seed),
+        gen::set(&detail::TestParams::engine),
         gen::set(&detail::TestParams::maxSuccess, gen::inRange(0, 100)),
         gen::set(&detail::TestParams::maxSize, gen::inRange(0, 101)),
         gen::set(&detail::TestParams::maxDiscardRatio, gen::inRange(0, 100)),
@@ -31,7 +39,8 @@ struct Arbitrary<detail::Configuration> {
         gen::set(&detail::Configuration::testParams),
         gen::set(&detail::Configuration::verboseProgress),
         gen::set(&detail::Configuration::verboseShrinking),
-        gen::set(&detail::Configuration::reproduce));
+        gen::set(&detail::Configuration::reproduce),
+        gen::set(&detail::Configuration::exampleDatabase));
   }
 };
 
@@ -59,6 +68,8 @@ struct Arbitrary<detail::Reproduce> {
     return gen::build<detail::Reproduce>(
         gen::set(&detail::Reproduce::random, test::trulyArbitraryRandom()),
         gen::set(&detail::Reproduce::size, gen::inRange<int>(0, 200)),
+        gen::set(&detail::Reproduce::ddminThreshold,
+                 gen::oneOf(gen::just(0), gen::nonNegative<int>())),
         gen::set(&detail::Reproduce::shrinkPath,
                  gen::container<std::vector<std::size_t>>(
                      gen::inRange<std::size_t>(0, 200))));
@@ -84,7 +95,10 @@ struct Arbitrary<detail::FailureResult> {
         gen::set(&detail::FailureResult::numSuccess, gen::positive<int>()),
         gen::set(&detail::FailureResult::description),
         gen::set(&detail::FailureResult::reproduce),
-        gen::set(&detail::FailureResult::counterExample));
+        gen::set(&detail::FailureResult::counterExample),
+        gen::set(&detail::FailureResult::numWastedShrinks,
+                 gen::inRange(0, 100)),
+        gen::set(&detail::FailureResult::partiallyShrunk));
   }
 };
 
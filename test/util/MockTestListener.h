@@ -22,6 +22,21 @@ struct MockTestListener : public rc::detail::TestListener {
     }
   }
 
+  void onShrinkCacheStats(int numHits, int numMisses) override {
+    onShrinkCacheStatsCount++;
+    if (onShrinkCacheStatsCallback) {
+      onShrinkCacheStatsCallback(numHits, numMisses);
+    }
+  }
+
+  void
+  onCommandStats(const std::vector<rc::detail::CommandStats> &stats) override {
+    onCommandStatsCount++;
+    if (onCommandStatsCallback) {
+      onCommandStatsCallback(stats);
+    }
+  }
+
   void onTestFinished(const rc::detail::TestMetadata &metadata,
                       const rc::detail::TestResult &result) override {
     onTestFinishedCount++;
@@ -38,6 +53,13 @@ struct MockTestListener : public rc::detail::TestListener {
       onShrinkTriedCallback;
   int onShrinkTriedCount = 0;
 
+  std::function<void(int, int)> onShrinkCacheStatsCallback;
+  int onShrinkCacheStatsCount = 0;
+
+  std::function<void(const std::vector<rc::detail::CommandStats> &)>
+      onCommandStatsCallback;
+  int onCommandStatsCount = 0;
+
   std::function<void(const rc::detail::TestMetadata &,
                      const rc::detail::TestResult &)> onTestFinishedCallback;
   int onTestFinishedCount = 0;